@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2011, Vicent Marti
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "markdown.h"
+#include "html.h"
+#include "text.h"
+#include "buffer.h"
+#include "houdini.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define READ_UNIT 1024
+#define OUTPUT_UNIT 64
+
+#define EXTENSIONS (MKDEXT_TABLES | MKDEXT_FENCED_CODE | MKDEXT_AUTOLINK | MKDEXT_STRIKETHROUGH)
+
+/* strip_html • the text of HTML output, the way an indexer without a */
+/*	text renderer would get it */
+static void
+strip_html(struct buf *ob, struct buf *work, const struct buf *html)
+{
+	size_t i = 0, org;
+
+	work->size = 0;
+	while (i < html->size) {
+		org = i;
+		while (i < html->size && html->data[i] != '<')
+			i++;
+
+		bufput(work, html->data + org, i - org);
+
+		while (i < html->size && html->data[i] != '>')
+			i++;
+		i++;
+	}
+
+	houdini_unescape_html(ob, work->data, work->size);
+}
+
+/* bench • times count renderings of the input to text, straight and */
+/*	through HTML */
+static void
+bench(const struct buf *ib, int count)
+{
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+	struct sd_markdown *text, *html;
+	struct buf *ob, *hb, *work;
+	clock_t start;
+	double text_time, html_time;
+	int i;
+
+	ob = bufnew(OUTPUT_UNIT);
+	hb = bufnew(OUTPUT_UNIT);
+	work = bufnew(OUTPUT_UNIT);
+
+	sdtext_renderer(&callbacks, 0);
+	text = sd_markdown_new(EXTENSIONS, 16, &callbacks, NULL);
+
+	sdhtml_renderer(&callbacks, &options, HTML_SINGLE_PASS);
+	html = sd_markdown_new(EXTENSIONS, 16, &callbacks, &options);
+
+	start = clock();
+	for (i = 0; i < count; ++i) {
+		ob->size = 0;
+		sd_markdown_render(ob, ib->data, ib->size, text);
+	}
+	text_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	start = clock();
+	for (i = 0; i < count; ++i) {
+		ob->size = 0;
+		hb->size = 0;
+		sd_markdown_render(hb, ib->data, ib->size, html);
+		strip_html(ob, work, hb);
+	}
+	html_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf("text:          %8.3f ms\n", text_time * 1000.0 / count);
+	printf("HTML, stripped: %7.3f ms\n", html_time * 1000.0 / count);
+
+	sd_markdown_free(text);
+	sd_markdown_free(html);
+	bufrelease(ob);
+	bufrelease(hb);
+	bufrelease(work);
+}
+
+/* main • prints the text of a document, or with -b count, times it */
+int
+main(int argc, char **argv)
+{
+	struct buf *ib, *ob;
+	int ret, count = 0;
+	FILE *in = stdin;
+
+	struct sd_callbacks callbacks;
+	struct sd_markdown *markdown;
+
+	if (argc > 2 && strcmp(argv[1], "-b") == 0) {
+		count = atoi(argv[2]);
+		if (count <= 0) {
+			fprintf(stderr, "Usage: plaintext [-b count] [file]\n");
+			return 1;
+		}
+
+		argc -= 2;
+		argv += 2;
+	}
+
+	/* opening the file if given from the command line */
+	if (argc > 1) {
+		in = fopen(argv[1], "r");
+		if (!in) {
+			fprintf(stderr,"Unable to open input file \"%s\": %s\n", argv[1], strerror(errno));
+			return 1;
+		}
+	}
+
+	/* reading everything */
+	ib = bufnew(READ_UNIT);
+	bufgrow(ib, READ_UNIT);
+	while ((ret = fread(ib->data + ib->size, 1, ib->asize - ib->size, in)) > 0) {
+		ib->size += ret;
+		bufgrow(ib, ib->size + READ_UNIT);
+	}
+
+	if (in != stdin)
+		fclose(in);
+
+	if (count) {
+		bench(ib, count);
+		bufrelease(ib);
+		return 0;
+	}
+
+	/* performing markdown parsing */
+	ob = bufnew(OUTPUT_UNIT);
+
+	sdtext_renderer(&callbacks, 0);
+	markdown = sd_markdown_new(EXTENSIONS, 16, &callbacks, NULL);
+
+	sd_markdown_render(ob, ib->data, ib->size, markdown);
+	sd_markdown_free(markdown);
+
+	/* writing the result to stdout */
+	ret = fwrite(ob->data, 1, ob->size, stdout);
+
+	/* cleanup */
+	bufrelease(ib);
+	bufrelease(ob);
+
+	return (ret < 0) ? -1 : 0;
+}
+
+/* vim: set filetype=c: */
@@ -30,6 +30,7 @@
 int
 main(int argc, char **argv)
 {
+	struct smartypants_stream stream;
 	struct buf *ib, *ob;
 	size_t ret;
 	FILE *in = stdin;
@@ -43,25 +44,25 @@ main(int argc, char **argv)
 		}
 	}
 
-	/* reading everything */
+	/* performing the substitutions as the input comes */
 	ib = bufnew(READ_UNIT);
+	ob = bufnew(OUTPUT_UNIT);
 	bufgrow(ib, READ_UNIT);
-	while ((ret = fread(ib->data + ib->size, 1, ib->asize - ib->size, in)) > 0) {
-		ib->size += ret;
-		bufgrow(ib, ib->size + READ_UNIT);
+	sdhtml_smartypants_init(&stream);
+
+	while ((ret = fread(ib->data, 1, ib->asize, in)) > 0) {
+		ob->size = 0;
+		sdhtml_smartypants_feed(ob, &stream, ib->data, ret);
+		(void)fwrite(ob->data, 1, ob->size, stdout);
 	}
 
+	ob->size = 0;
+	sdhtml_smartypants_finish(ob, &stream);
+	(void)fwrite(ob->data, 1, ob->size, stdout);
+
 	if (in != stdin)
 		fclose(in);
 
-	/* performing markdown parsing */
-	ob = bufnew(OUTPUT_UNIT);
-
-	sdhtml_smartypants(ob, ib->data, ib->size);
-
-	/* writing the result to stdout */
-	(void)fwrite(ob->data, 1, ob->size, stdout);
-
 	/* cleanup */
 	bufrelease(ib);
 	bufrelease(ob);
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+# gen_entities.py - perfect hash of the HTML5 named character references
+
+# Usage: gen_entities.py html_entity_names.txt > src/html_entities.h
+#
+# Each line of the input holds an entity name, without '&' and ';',
+# followed by its code points in decimal. The output is a hash and
+# displace perfect hash: the name hashed with seed 0 picks a bucket,
+# and the bucket's seed hashes it again into its own slot.
+
+import sys
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+
+def entity_hash(seed, name):
+	h = FNV_OFFSET ^ seed
+	for c in bytearray(name.encode('ascii')):
+		h ^= c
+		h = (h * FNV_PRIME) & 0xffffffff
+	return h
+
+def build(names, slot_count, bucket_count):
+	buckets = [[] for _ in range(bucket_count)]
+	for name in names:
+		buckets[entity_hash(0, name) % bucket_count].append(name)
+
+	slots = [None] * slot_count
+	seeds = [0] * bucket_count
+
+	for b in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+		if not buckets[b]:
+			break
+
+		for seed in range(1, 65536):
+			taken = set()
+			for name in buckets[b]:
+				slot = entity_hash(seed, name) % slot_count
+				if slots[slot] is not None or slot in taken:
+					break
+				taken.add(slot)
+			else:
+				break
+		else:
+			raise Exception("no seed for bucket %d" % b)
+
+		seeds[b] = seed
+		for name in buckets[b]:
+			slots[entity_hash(seed, name) % slot_count] = name
+
+	return slots, seeds
+
+def c_string(data):
+	return ''.join('\\%03o' % c for c in bytearray(data))
+
+def main(path):
+	entities = {}
+	for line in open(path):
+		fields = line.split()
+		if fields:
+			entities[fields[0]] = u''.join(
+				(b'\\U%08x' % int(cp)).decode('unicode_escape') for cp in fields[1:])
+
+	names = sorted(entities)
+	slot_count = len(names) * 5 // 4
+	bucket_count = len(names) // 3
+	slots, seeds = build(names, slot_count, bucket_count)
+
+	offsets = {}
+	pool = []
+	size = 0
+	for name in names:
+		offsets[name] = size
+		pool.append(name)
+		size += len(name) + 1
+
+	out = sys.stdout
+	out.write("/* C code produced by gen_entities.py */\n")
+	out.write("/* Command-line: gen_entities.py %s */\n\n" % path)
+
+	out.write("#define ENTITY_COUNT %d\n" % len(names))
+	out.write("#define ENTITY_MIN_LENGTH %d\n" % min(len(n) for n in names))
+	out.write("#define ENTITY_MAX_LENGTH %d\n" % max(len(n) for n in names))
+	out.write("#define ENTITY_SLOTS %d\n" % slot_count)
+	out.write("#define ENTITY_BUCKETS %d\n\n" % bucket_count)
+
+	out.write("struct html_entity {\n")
+	out.write("\tunsigned short name;\t/* offset in entity_names */\n")
+	out.write("\tunsigned char size;\t/* length of the name, 0 for free slots */\n")
+	out.write("\tchar utf8[7];\t\t/* NUL-terminated value */\n")
+	out.write("};\n\n")
+
+	out.write("static const char entity_names[] =\n")
+	for name in pool:
+		out.write("\t\"%s\\0\"\n" % name)
+	out.write("\t;\n\n")
+
+	out.write("static const unsigned short entity_seeds[ENTITY_BUCKETS] = {")
+	for i, seed in enumerate(seeds):
+		out.write("%s%d," % ("\n\t" if i % 12 == 0 else " ", seed))
+	out.write("\n};\n\n")
+
+	out.write("static const struct html_entity entity_table[ENTITY_SLOTS] = {\n")
+	for name in slots:
+		if name is None:
+			out.write("\t{ 0, 0, \"\" },\n")
+		else:
+			out.write("\t{ %d, %d, \"%s\" }, /* %s */\n" % (
+				offsets[name], len(name), c_string(entities[name].encode('utf-8')), name))
+	out.write("};\n\n")
+
+	out.write("""static unsigned int
+hash_entity(unsigned int seed, const char *str, unsigned int len)
+{
+	unsigned int h = %du ^ seed, i;
+
+	for (i = 0; i < len; ++i) {
+		h ^= (unsigned char)str[i];
+		h = (h * %du) & 0xffffffff;
+	}
+
+	return h;
+}
+
+static const struct html_entity *
+find_entity(const char *str, unsigned int len)
+{
+	const struct html_entity *entity;
+	unsigned int seed;
+
+	if (len < ENTITY_MIN_LENGTH || len > ENTITY_MAX_LENGTH)
+		return 0;
+
+	seed = entity_seeds[hash_entity(0, str, len) %% ENTITY_BUCKETS];
+	entity = &entity_table[hash_entity(seed, str, len) %% ENTITY_SLOTS];
+
+	if (entity->size == len && memcmp(entity_names + entity->name, str, len) == 0)
+		return entity;
+
+	return 0;
+}
+""" % (FNV_OFFSET, FNV_PRIME))
+
+if __name__ == '__main__':
+	main(sys.argv[1])
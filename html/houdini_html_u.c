@@ -0,0 +1,110 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "houdini.h"
+#include "markdown.h"
+
+#define UNESCAPE_MAX_NAME 32
+
+/* utf8_put • appends a code point as UTF-8, 0 when it is not a valid one */
+static int
+utf8_put(struct buf *ob, unsigned long cp)
+{
+	uint8_t enc[4];
+
+	if (cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+		return 0;
+
+	if (cp < 0x80) {
+		bufputc(ob, (int)cp);
+	} else if (cp < 0x800) {
+		enc[0] = 0xC0 | (cp >> 6);
+		enc[1] = 0x80 | (cp & 0x3F);
+		bufput(ob, enc, 2);
+	} else if (cp < 0x10000) {
+		enc[0] = 0xE0 | (cp >> 12);
+		enc[1] = 0x80 | ((cp >> 6) & 0x3F);
+		enc[2] = 0x80 | (cp & 0x3F);
+		bufput(ob, enc, 3);
+	} else {
+		enc[0] = 0xF0 | (cp >> 18);
+		enc[1] = 0x80 | ((cp >> 12) & 0x3F);
+		enc[2] = 0x80 | ((cp >> 6) & 0x3F);
+		enc[3] = 0x80 | (cp & 0x3F);
+		bufput(ob, enc, 4);
+	}
+
+	return 1;
+}
+
+/* unescape_ent • decodes the entity following a '&' */
+/*	returns the length consumed after the '&', 0 when left as is */
+static size_t
+unescape_ent(struct buf *ob, const uint8_t *src, size_t size)
+{
+	size_t i = 0;
+
+	if (size > 0 && src[0] == '#') {
+		unsigned long cp = 0;
+		int hex = 0;
+
+		i = 1;
+		if (i < size && (src[i] == 'x' || src[i] == 'X')) {
+			hex = 1;
+			i++;
+		}
+
+		for (; i < size && i < 10; ++i) {
+			if (_isdigit(src[i]))
+				cp = cp * (hex ? 16 : 10) + (src[i] - '0');
+			else if (hex && src[i] >= 'a' && src[i] <= 'f')
+				cp = cp * 16 + (src[i] - 'a' + 10);
+			else if (hex && src[i] >= 'A' && src[i] <= 'F')
+				cp = cp * 16 + (src[i] - 'A' + 10);
+			else
+				break;
+		}
+
+		if (i < size && src[i] == ';' && i > (size_t)(hex + 1) && utf8_put(ob, cp))
+			return i + 1;
+	} else {
+		const char *value;
+
+		while (i < size && i <= UNESCAPE_MAX_NAME && isalnum(src[i]))
+			i++;
+
+		if (i < size && src[i] == ';' && (value = sd_html_entity(src, i)) != NULL) {
+			bufputs(ob, value);
+			return i + 1;
+		}
+	}
+
+	bufputc(ob, '&');
+	return 0;
+}
+
+void
+houdini_unescape_html(struct buf *ob, const uint8_t *src, size_t size)
+{
+	size_t i = 0, org;
+
+	bufgrow(ob, size);
+
+	while (i < size) {
+		org = i;
+		while (i < size && src[i] != '&')
+			i++;
+
+		if (i > org)
+			bufput(ob, src + org, i - org);
+
+		/* unescaping */
+		if (i >= size)
+			break;
+
+		i++;
+		i += unescape_ent(ob, src + i, size - i);
+	}
+}
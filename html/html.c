@@ -24,6 +24,7 @@
 #include <ctype.h>
 
 #include "houdini.h"
+#include "smartypants.h"
 
 #define USE_XHTML(opt) (opt->flags & HTML_USE_XHTML)
 
@@ -70,6 +71,22 @@ static inline void escape_href(struct buf *ob, const uint8_t *source, size_t len
 	houdini_escape_href(ob, source, length);
 }
 
+static inline int is_safe_link(struct html_renderopt *options, const uint8_t *link, size_t length)
+{
+	if (options->safe_schemes)
+		return sd_autolink_issafe_trie(options->safe_schemes, link, length);
+
+	return sd_autolink_issafe(link, length);
+}
+
+/* rndr_newline • separates a block from the previous one in its container */
+static inline void
+rndr_newline(struct buf *ob, struct html_renderopt *options)
+{
+	if (ob->size > options->block_start)
+		bufputc(ob, '\n');
+}
+
 /********************
  * GENERIC RENDERER *
  ********************/
@@ -82,7 +99,7 @@ rndr_autolink(struct buf *ob, const struct buf *link, enum mkd_autolink type, vo
 		return 0;
 
 	if ((options->flags & HTML_SAFELINK) != 0 &&
-		!sd_autolink_issafe(link->data, link->size) &&
+		!is_safe_link(options, link->data, link->size) &&
 		type != MKDA_EMAIL)
 		return 0;
 
@@ -118,7 +135,7 @@ rndr_autolink(struct buf *ob, const struct buf *link, enum mkd_autolink type, vo
 static void
 rndr_blockcode(struct buf *ob, const struct buf *text, const struct buf *lang, void *opaque)
 {
-	if (ob->size) bufputc(ob, '\n');
+	rndr_newline(ob, opaque);
 
 	if (lang && lang->size) {
 		size_t i, cls;
@@ -154,7 +171,7 @@ rndr_blockcode(struct buf *ob, const struct buf *text, const struct buf *lang, v
 static void
 rndr_blockquote(struct buf *ob, const struct buf *text, void *opaque)
 {
-	if (ob->size) bufputc(ob, '\n');
+	rndr_newline(ob, opaque);
 	BUFPUTSL(ob, "<blockquote>\n");
 	if (text) bufput(ob, text->data, text->size);
 	BUFPUTSL(ob, "</blockquote>\n");
@@ -213,28 +230,105 @@ rndr_linebreak(struct buf *ob, void *opaque)
 }
 
 static void
-rndr_header(struct buf *ob, const struct buf *text, int level, void *opaque)
+toc_open(struct buf *ob, int level, struct html_renderopt *options)
 {
-	struct html_renderopt *options = opaque;
+	/* set the level offset if this is the first header
+	 * we're parsing for the document */
+	if (options->toc_data.current_level == 0) {
+		options->toc_data.level_offset = level - 1;
+	}
+	level -= options->toc_data.level_offset;
 
-	if (ob->size)
-		bufputc(ob, '\n');
+	if (level > options->toc_data.current_level) {
+		while (level > options->toc_data.current_level) {
+			BUFPUTSL(ob, "<ul>\n<li>\n");
+			options->toc_data.current_level++;
+		}
+	} else if (level < options->toc_data.current_level) {
+		BUFPUTSL(ob, "</li>\n");
+		while (level < options->toc_data.current_level) {
+			BUFPUTSL(ob, "</ul>\n</li>\n");
+			options->toc_data.current_level--;
+		}
+		BUFPUTSL(ob,"<li>\n");
+	} else {
+		BUFPUTSL(ob,"</li>\n<li>\n");
+	}
+}
+
+static void
+toc_close(struct buf *ob, struct html_renderopt *options)
+{
+	while (options->toc_data.current_level > 0) {
+		BUFPUTSL(ob, "</li>\n</ul>\n");
+		options->toc_data.current_level--;
+	}
+}
+
+/* adds the header just rendered to the side TOC, keeping its markup
+ * but the links, which cannot nest in the one to the header */
+static void
+rndr_toc_entry(const uint8_t *data, size_t size, int level, struct html_renderopt *options)
+{
+	struct buf *toc = options->toc;
+	size_t i = 0, org;
+
+	toc_open(toc, level, options);
+	bufprintf(toc, "<a href=\"#toc_%d\">", options->toc_data.header_count - 1);
+
+	while (i < size) {
+		org = i;
+		while (i < size && data[i] != '<')
+			i++;
+
+		if (i > org)
+			bufput(toc, data + org, i - org);
+
+		if (i >= size)
+			break;
+
+		if (sdhtml_is_tag(data + i, size - i, "a") != HTML_TAG_NONE) {
+			while (i < size && data[i] != '>')
+				i++;
+		} else
+			bufputc(toc, '<');
+
+		i++;
+	}
+
+	BUFPUTSL(toc, "</a>\n");
+}
+
+static void
+rndr_header_open(struct buf *ob, int level, struct html_renderopt *options)
+{
+	rndr_newline(ob, options);
 
 	if (options->flags & HTML_TOC)
 		bufprintf(ob, "<h%d id=\"toc_%d\">", level, options->toc_data.header_count++);
 	else
 		bufprintf(ob, "<h%d>", level);
+}
+
+static void
+rndr_header(struct buf *ob, const struct buf *text, int level, void *opaque)
+{
+	struct html_renderopt *options = opaque;
 
+	rndr_header_open(ob, level, options);
 	if (text) bufput(ob, text->data, text->size);
 	bufprintf(ob, "</h%d>\n", level);
+
+	if (options->toc && (options->flags & HTML_TOC))
+		rndr_toc_entry(text ? text->data : NULL, text ? text->size : 0, level, options);
 }
 
 static int
-rndr_link(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *content, void *opaque)
+rndr_link_open(struct buf *ob, const struct buf *link, const struct buf *title, void *opaque)
 {
 	struct html_renderopt *options = opaque;
 
-	if (link != NULL && (options->flags & HTML_SAFELINK) != 0 && !sd_autolink_issafe(link->data, link->size))
+	if (link != NULL && (options->flags & HTML_SAFELINK) != 0 && !is_safe_link(options, link->data, link->size))
 		return 0;
 
 	BUFPUTSL(ob, "<a href=\"");
@@ -255,6 +349,15 @@ rndr_link(struct buf *ob, const struct buf *link, const struct buf *title, const
 		BUFPUTSL(ob, "\">");
 	}
 
+	return 1;
+}
+
+static int
+rndr_link(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *content, void *opaque)
+{
+	if (!rndr_link_open(ob, link, title, opaque))
+		return 0;
+
 	if (content && content->size) bufput(ob, content->data, content->size);
 	BUFPUTSL(ob, "</a>");
 	return 1;
@@ -263,7 +366,7 @@ rndr_link(struct buf *ob, const struct buf *link, const struct buf *title, const
 static void
 rndr_list(struct buf *ob, const struct buf *text, int flags, void *opaque)
 {
-	if (ob->size) bufputc(ob, '\n');
+	rndr_newline(ob, opaque);
 	bufput(ob, flags & MKD_LIST_ORDERED ? "<ol>\n" : "<ul>\n", 5);
 	if (text) bufput(ob, text->data, text->size);
 	bufput(ob, flags & MKD_LIST_ORDERED ? "</ol>\n" : "</ul>\n", 6);
@@ -283,13 +386,49 @@ rndr_listitem(struct buf *ob, const struct buf *text, int flags, void *opaque)
 	BUFPUTSL(ob, "</li>\n");
 }
 
+/* rndr_paragraph_close • ends a paragraph whose text starts at org in ob */
+static void
+rndr_paragraph_close(struct buf *ob, size_t org, struct html_renderopt *options)
+{
+	if (options->flags & HTML_HARD_WRAP) {
+		const char *br = USE_XHTML(options) ? "<br/>\n" : "<br>\n";
+		size_t br_size = strlen(br), size = ob->size, lines = 0, i, w;
+
+		/*
+		 * do not insert a line break if this newline
+		 * is the last character on the paragraph
+		 */
+		if (size > org && ob->data[size - 1] == '\n')
+			size--;
+
+		for (i = org; i < size; ++i)
+			if (ob->data[i] == '\n')
+				lines++;
+
+		/* the line breaks are expanded in place, from the back */
+		w = size + lines * (br_size - 1);
+		bufgrow(ob, w);
+		ob->size = w;
+
+		for (i = size; lines; ) {
+			if (ob->data[--i] == '\n') {
+				w -= br_size;
+				memcpy(ob->data + w, br, br_size);
+				lines--;
+			} else
+				ob->data[--w] = ob->data[i];
+		}
+	}
+
+	BUFPUTSL(ob, "</p>\n");
+}
+
 static void
 rndr_paragraph(struct buf *ob, const struct buf *text, void *opaque)
 {
-	struct html_renderopt *options = opaque;
-	size_t i = 0;
+	size_t i = 0, org;
 
-	if (ob->size) bufputc(ob, '\n');
+	rndr_newline(ob, opaque);
 
 	if (!text || !text->size)
 		return;
@@ -300,30 +439,9 @@ rndr_paragraph(struct buf *ob, const struct buf *text, void *opaque)
 		return;
 
 	BUFPUTSL(ob, "<p>");
-	if (options->flags & HTML_HARD_WRAP) {
-		size_t org;
-		while (i < text->size) {
-			org = i;
-			while (i < text->size && text->data[i] != '\n')
-				i++;
-
-			if (i > org)
-				bufput(ob, text->data + org, i - org);
-
-			/*
-			 * do not insert a line break if this newline
-			 * is the last character on the paragraph
-			 */
-			if (i >= text->size - 1)
-				break;
-
-			rndr_linebreak(ob, opaque);
-			i++;
-		}
-	} else {
-		bufput(ob, &text->data[i], text->size - i);
-	}
-	BUFPUTSL(ob, "</p>\n");
+	org = ob->size;
+	bufput(ob, &text->data[i], text->size - i);
+	rndr_paragraph_close(ob, org, opaque);
 }
 
 static void
@@ -336,7 +454,7 @@ rndr_raw_block(struct buf *ob, const struct buf *text, void *opaque)
 	org = 0;
 	while (org < sz && text->data[org] == '\n') org++;
 	if (org >= sz) return;
-	if (ob->size) bufputc(ob, '\n');
+	rndr_newline(ob, opaque);
 	bufput(ob, text->data + org, sz - org);
 	bufputc(ob, '\n');
 }
@@ -355,7 +473,7 @@ static void
 rndr_hrule(struct buf *ob, void *opaque)
 {
 	struct html_renderopt *options = opaque;
-	if (ob->size) bufputc(ob, '\n');
+	rndr_newline(ob, options);
 	bufputs(ob, USE_XHTML(options) ? "<hr/>\n" : "<hr>\n");
 }
 
@@ -407,6 +525,16 @@ rndr_raw_html(struct buf *ob, const struct buf *text, void *opaque)
 		sdhtml_is_tag(text->data, text->size, "img"))
 		return 1;
 
+	/* SmartyPants leaves the text of code and the like alone */
+	if (options->flags & HTML_SMARTYPANTS) {
+		int tag = sdhtml_smartypants_tag(text->data, text->size);
+
+		if (tag > 0 && !options->smartypants.skip_tag)
+			options->smartypants.skip_tag = tag;
+		else if (tag < 0 && -tag == options->smartypants.skip_tag)
+			options->smartypants.skip_tag = 0;
+	}
+
 	bufput(ob, text->data, text->size);
 	return 1;
 }
@@ -414,7 +542,7 @@ rndr_raw_html(struct buf *ob, const struct buf *text, void *opaque)
 static void
 rndr_table(struct buf *ob, const struct buf *header, const struct buf *body, void *opaque)
 {
-	if (ob->size) bufputc(ob, '\n');
+	rndr_newline(ob, opaque);
 	BUFPUTSL(ob, "<table><thead>\n");
 	if (header)
 		bufput(ob, header->data, header->size);
@@ -424,6 +552,22 @@ rndr_table(struct buf *ob, const struct buf *header, const struct buf *body, voi
 	BUFPUTSL(ob, "</tbody></table>\n");
 }
 
+static void
+rndr_table_begin(struct buf *ob, const struct buf *header, void *opaque)
+{
+	rndr_newline(ob, opaque);
+	BUFPUTSL(ob, "<table><thead>\n");
+	if (header)
+		bufput(ob, header->data, header->size);
+	BUFPUTSL(ob, "</thead><tbody>\n");
+}
+
+static void
+rndr_table_end(struct buf *ob, void *opaque)
+{
+	BUFPUTSL(ob, "</tbody></table>\n");
+}
+
 static void
 rndr_tablerow(struct buf *ob, const struct buf *text, void *opaque)
 {
@@ -434,7 +578,7 @@ rndr_tablerow(struct buf *ob, const struct buf *text, void *opaque)
 }
 
 static void
-rndr_tablecell(struct buf *ob, const struct buf *text, int flags, void *opaque)
+rndr_tablecell_open(struct buf *ob, int flags)
 {
 	if (flags & MKD_TABLE_HEADER) {
 		BUFPUTSL(ob, "<th");
@@ -458,10 +602,11 @@ rndr_tablecell(struct buf *ob, const struct buf *text, int flags, void *opaque)
 	default:
 		BUFPUTSL(ob, ">");
 	}
+}
 
-	if (text)
-		bufput(ob, text->data, text->size);
-
+static void
+rndr_tablecell_close(struct buf *ob, int flags)
+{
 	if (flags & MKD_TABLE_HEADER) {
 		BUFPUTSL(ob, "</th>\n");
 	} else {
@@ -469,6 +614,17 @@ rndr_tablecell(struct buf *ob, const struct buf *text, int flags, void *opaque)
 	}
 }
 
+static void
+rndr_tablecell(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+	rndr_tablecell_open(ob, flags);
+
+	if (text)
+		bufput(ob, text->data, text->size);
+
+	rndr_tablecell_close(ob, flags);
+}
+
 static int
 rndr_superscript(struct buf *ob, const struct buf *text, void *opaque)
 {
@@ -482,38 +638,226 @@ rndr_superscript(struct buf *ob, const struct buf *text, void *opaque)
 static void
 rndr_normal_text(struct buf *ob, const struct buf *text, void *opaque)
 {
-	if (text)
+	struct html_renderopt *options = opaque;
+
+	if (!text)
+		return;
+
+	if ((options->flags & HTML_SMARTYPANTS) && !options->smartypants.skip_tag)
+		sdhtml_smartypants_escape(ob, &options->smartypants.data,
+			ob->size ? ob->data[ob->size - 1] : 0, text->data, text->size);
+	else
 		escape_html(ob, text->data, text->size);
 }
 
 static void
-toc_header(struct buf *ob, const struct buf *text, int level, void *opaque)
+rndr_doc_header(struct buf *ob, void *opaque)
 {
 	struct html_renderopt *options = opaque;
 
-	/* set the level offset if this is the first header
-	 * we're parsing for the document */
-	if (options->toc_data.current_level == 0) {
-		options->toc_data.level_offset = level - 1;
+	memset(&options->smartypants, 0x0, sizeof(options->smartypants));
+}
+
+static void
+rndr_doc_footer(struct buf *ob, void *opaque)
+{
+	struct html_renderopt *options = opaque;
+
+	if (options->toc && (options->flags & HTML_TOC))
+		toc_close(options->toc, options);
+}
+
+static int
+rndr_enter(struct buf *ob, const struct sd_node *node, void *opaque)
+{
+	struct html_renderopt *options = opaque;
+
+	switch (node->type) {
+	case SD_NODE_BLOCKQUOTE:
+		rndr_newline(ob, options);
+		BUFPUTSL(ob, "<blockquote>\n");
+		break;
+
+	case SD_NODE_HEADER:
+		rndr_header_open(ob, node->flags, options);
+		break;
+
+	case SD_NODE_LIST:
+		rndr_newline(ob, options);
+		bufput(ob, node->flags & MKD_LIST_ORDERED ? "<ol>\n" : "<ul>\n", 5);
+		break;
+
+	case SD_NODE_LISTITEM:
+		BUFPUTSL(ob, "<li>");
+		break;
+
+	case SD_NODE_PARAGRAPH:
+		rndr_newline(ob, options);
+		BUFPUTSL(ob, "<p>");
+		break;
+
+	case SD_NODE_TABLE:
+		rndr_newline(ob, options);
+		BUFPUTSL(ob, "<table>");
+		break;
+
+	case SD_NODE_TABLE_HEAD:
+		BUFPUTSL(ob, "<thead>\n");
+		break;
+
+	case SD_NODE_TABLE_BODY:
+		BUFPUTSL(ob, "<tbody>\n");
+		break;
+
+	case SD_NODE_TABLE_ROW:
+		BUFPUTSL(ob, "<tr>\n");
+		break;
+
+	case SD_NODE_TABLE_CELL:
+		rndr_tablecell_open(ob, node->flags);
+		break;
+
+	case SD_NODE_EMPHASIS:
+		BUFPUTSL(ob, "<em>");
+		break;
+
+	case SD_NODE_DOUBLE_EMPHASIS:
+		BUFPUTSL(ob, "<strong>");
+		break;
+
+	case SD_NODE_TRIPLE_EMPHASIS:
+		BUFPUTSL(ob, "<strong><em>");
+		break;
+
+	case SD_NODE_STRIKETHROUGH:
+		BUFPUTSL(ob, "<del>");
+		break;
+
+	case SD_NODE_SUPERSCRIPT:
+		BUFPUTSL(ob, "<sup>");
+		break;
+
+	case SD_NODE_LINK:
+		return rndr_link_open(ob, node->link, node->title, opaque);
 	}
-	level -= options->toc_data.level_offset;
 
-	if (level > options->toc_data.current_level) {
-		while (level > options->toc_data.current_level) {
-			BUFPUTSL(ob, "<ul>\n<li>\n");
-			options->toc_data.current_level++;
-		}
-	} else if (level < options->toc_data.current_level) {
+	/* blocks inside start a new container */
+	if (node->type < SD_NODE_EMPHASIS)
+		options->block_start = ob->size;
+
+	return 1;
+}
+
+static int
+rndr_leave(struct buf *ob, const struct sd_node *node, void *opaque)
+{
+	struct html_renderopt *options = opaque;
+	size_t i;
+
+	if (node->type < SD_NODE_EMPHASIS)
+		options->block_start = node->parent_offset;
+
+	switch (node->type) {
+	case SD_NODE_BLOCKQUOTE:
+		BUFPUTSL(ob, "</blockquote>\n");
+		break;
+
+	case SD_NODE_HEADER:
+		if (options->toc && (options->flags & HTML_TOC))
+			rndr_toc_entry(ob->data + node->content_offset,
+				ob->size - node->content_offset, node->flags, options);
+		bufprintf(ob, "</h%d>\n", node->flags);
+		break;
+
+	case SD_NODE_LIST:
+		bufput(ob, node->flags & MKD_LIST_ORDERED ? "</ol>\n" : "</ul>\n", 6);
+		break;
+
+	case SD_NODE_LISTITEM:
+		while (ob->size > node->content_offset && ob->data[ob->size - 1] == '\n')
+			ob->size--;
 		BUFPUTSL(ob, "</li>\n");
-		while (level < options->toc_data.current_level) {
-			BUFPUTSL(ob, "</ul>\n</li>\n");
-			options->toc_data.current_level--;
+		break;
+
+	case SD_NODE_PARAGRAPH:
+		i = node->content_offset;
+		while (i < ob->size && isspace(ob->data[i])) i++;
+
+		/* empty paragraphs only leave their separator behind */
+		if (i == ob->size) {
+			ob->size = node->offset;
+			rndr_newline(ob, options);
+			break;
 		}
-		BUFPUTSL(ob,"<li>\n");
-	} else {
-		BUFPUTSL(ob,"</li>\n<li>\n");
+
+		if (i > node->content_offset) {
+			memmove(ob->data + node->content_offset, ob->data + i, ob->size - i);
+			ob->size -= i - node->content_offset;
+		}
+
+		rndr_paragraph_close(ob, node->content_offset, options);
+		break;
+
+	case SD_NODE_TABLE:
+		BUFPUTSL(ob, "</table>\n");
+		break;
+
+	case SD_NODE_TABLE_HEAD:
+		BUFPUTSL(ob, "</thead>");
+		break;
+
+	case SD_NODE_TABLE_BODY:
+		BUFPUTSL(ob, "</tbody>");
+		break;
+
+	case SD_NODE_TABLE_ROW:
+		BUFPUTSL(ob, "</tr>\n");
+		break;
+
+	case SD_NODE_TABLE_CELL:
+		rndr_tablecell_close(ob, node->flags);
+		break;
+
+	case SD_NODE_EMPHASIS:
+		if (ob->size == node->content_offset) return 0;
+		BUFPUTSL(ob, "</em>");
+		break;
+
+	case SD_NODE_DOUBLE_EMPHASIS:
+		if (ob->size == node->content_offset) return 0;
+		BUFPUTSL(ob, "</strong>");
+		break;
+
+	case SD_NODE_TRIPLE_EMPHASIS:
+		if (ob->size == node->content_offset) return 0;
+		BUFPUTSL(ob, "</em></strong>");
+		break;
+
+	case SD_NODE_STRIKETHROUGH:
+		if (ob->size == node->content_offset) return 0;
+		BUFPUTSL(ob, "</del>");
+		break;
+
+	case SD_NODE_SUPERSCRIPT:
+		if (ob->size == node->content_offset) return 0;
+		BUFPUTSL(ob, "</sup>");
+		break;
+
+	case SD_NODE_LINK:
+		BUFPUTSL(ob, "</a>");
+		break;
 	}
 
+	return 1;
+}
+
+static void
+toc_header(struct buf *ob, const struct buf *text, int level, void *opaque)
+{
+	struct html_renderopt *options = opaque;
+
+	toc_open(ob, level, options);
+
 	bufprintf(ob, "<a href=\"#toc_%d\">", options->toc_data.header_count++);
 	if (text)
 		escape_html(ob, text->data, text->size);
@@ -531,12 +875,7 @@ toc_link(struct buf *ob, const struct buf *link, const struct buf *title, const
 static void
 toc_finalize(struct buf *ob, void *opaque)
 {
-	struct html_renderopt *options = opaque;
-
-	while (options->toc_data.current_level > 0) {
-		BUFPUTSL(ob, "</li>\n</ul>\n");
-		options->toc_data.current_level--;
-	}
+	toc_close(ob, opaque);
 }
 
 void
@@ -572,6 +911,12 @@ sdhtml_toc_renderer(struct sd_callbacks *callbacks, struct html_renderopt *optio
 
 		NULL,
 		toc_finalize,
+
+		NULL,
+		NULL,
+
+		NULL,
+		NULL,
 	};
 
 	memset(options, 0x0, sizeof(struct html_renderopt));
@@ -611,6 +956,12 @@ sdhtml_renderer(struct sd_callbacks *callbacks, struct html_renderopt *options,
 		NULL,
 		rndr_normal_text,
 
+		rndr_doc_header,
+		rndr_doc_footer,
+
+		rndr_table_begin,
+		rndr_table_end,
+
 		NULL,
 		NULL,
 	};
@@ -632,4 +983,12 @@ sdhtml_renderer(struct sd_callbacks *callbacks, struct html_renderopt *options,
 
 	if (render_flags & HTML_SKIP_HTML || render_flags & HTML_ESCAPE)
 		callbacks->blockhtml = NULL;
+
+	/* the enter and leave callbacks render the built-in elements in */
+	/* place, so they are left out unless asked for: with them set, */
+	/* overriding header, link, etc. afterwards would have no effect */
+	if (render_flags & HTML_SINGLE_PASS) {
+		callbacks->enter = rndr_enter;
+		callbacks->leave = rndr_leave;
+	}
 }
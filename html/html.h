@@ -25,6 +25,26 @@
 extern "C" {
 #endif
 
+/* smartypants_data - SmartyPants state carried from a text to the next */
+struct smartypants_data {
+	int in_squote;
+	int in_dquote;
+};
+
+/* longest text sdhtml_smartypants_feed may hold back for the next part */
+#define SMARTYPANTS_LOOKAHEAD 10
+
+/* smartypants_stream - state of sdhtml_smartypants over a text given in */
+/* parts, which takes the same fixed space whatever their size */
+struct smartypants_stream {
+	struct smartypants_data data;
+	int state;				/* position in or out of the tags */
+	int skip_tag;			/* tag whose content is being passed */
+	uint8_t previous_char;
+	uint8_t pending[SMARTYPANTS_LOOKAHEAD];
+	size_t pending_size;
+};
+
 struct html_renderopt {
 	struct {
 		int header_count;
@@ -36,6 +56,22 @@ struct html_renderopt {
 
 	/* extra callbacks */
 	void (*link_attributes)(struct buf *ob, const struct buf *url, void *self);
+
+	/* links allowed by HTML_SAFELINK, NULL for sd_autolink_issafe's */
+	const struct sd_scheme_trie *safe_schemes;
+
+	/* with HTML_TOC, the table of contents of the headers rendered is */
+	/* appended here in the same pass, NULL for none */
+	struct buf *toc;
+
+	/* where the content of the current block starts in the output */
+	size_t block_start;
+
+	/* HTML_SMARTYPANTS state, reset for every document */
+	struct {
+		struct smartypants_data data;
+		int skip_tag;		/* raw HTML tag whose content is left as is */
+	} smartypants;
 };
 
 typedef enum {
@@ -49,6 +85,8 @@ typedef enum {
 	HTML_HARD_WRAP = (1 << 7),
 	HTML_USE_XHTML = (1 << 8),
 	HTML_ESCAPE = (1 << 9),
+	HTML_SMARTYPANTS = (1 << 10),
+	HTML_SINGLE_PASS = (1 << 11),
 } html_render_mode;
 
 typedef enum {
@@ -69,6 +107,27 @@ sdhtml_toc_renderer(struct sd_callbacks *callbacks, struct html_renderopt *optio
 extern void
 sdhtml_smartypants(struct buf *ob, const uint8_t *text, size_t size);
 
+/* sdhtml_smartypants_init - starts a stream of text for SmartyPants */
+extern void
+sdhtml_smartypants_init(struct smartypants_stream *stream);
+
+/* sdhtml_smartypants_feed - appends to ob the output of sdhtml_smartypants */
+/* for the next part of a stream, but for the end of the part where a */
+/* substitution or tag may carry on in the next */
+extern void
+sdhtml_smartypants_feed(struct buf *ob, struct smartypants_stream *stream,
+	const uint8_t *text, size_t size);
+
+/* sdhtml_smartypants_finish - appends the end of the stream held back, */
+/* after which the stream starts over */
+extern void
+sdhtml_smartypants_finish(struct buf *ob, struct smartypants_stream *stream);
+
+/* sdhtml_smartypants_parallel - sdhtml_smartypants over large texts split */
+/* between up to the given number of threads, with the same output */
+extern void
+sdhtml_smartypants_parallel(struct buf *ob, const uint8_t *text, size_t size, int threads);
+
 #ifdef __cplusplus
 }
 #endif
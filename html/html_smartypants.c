@@ -16,6 +16,7 @@
 
 #include "buffer.h"
 #include "html.h"
+#include "smartypants.h"
 
 #include <string.h>
 #include <stdlib.h>
@@ -24,12 +25,17 @@
 
 #if defined(_WIN32)
 #define snprintf	_snprintf		
+#else
+#include <pthread.h>
+#include <unistd.h>
 #endif
 
-struct smartypants_data {
-	int in_squote;
-	int in_dquote;
-};
+/* texts shorter than this per thread are not worth splitting */
+#ifndef SMARTYPANTS_CHUNK_MIN
+#define SMARTYPANTS_CHUNK_MIN (64 * 1024)
+#endif
+
+#define SMARTYPANTS_THREADS_MAX 64
 
 static size_t smartypants_cb__ltag(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
 static size_t smartypants_cb__dquote(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
@@ -83,54 +89,71 @@ word_boundary(uint8_t c)
 	return c == 0 || isspace(c) || ispunct(c);
 }
 
-static int
-smartypants_quotes(struct buf *ob, uint8_t previous_char, uint8_t next_char, uint8_t quote, int *is_open)
+/* smartypants_turn • opens or closes a quote where the text around allows */
+static inline int
+smartypants_turn(uint8_t previous_char, uint8_t next_char, int *is_open)
 {
-	char ent[8];
-
 	if (*is_open && !word_boundary(next_char))
 		return 0;
 
 	if (!(*is_open) && !word_boundary(previous_char))
 		return 0;
 
-	snprintf(ent, sizeof(ent), "&%c%cquo;", (*is_open) ? 'r' : 'l', quote);
 	*is_open = !(*is_open);
+	return 1;
+}
+
+static int
+smartypants_quotes(struct buf *ob, uint8_t previous_char, uint8_t next_char, uint8_t quote, int *is_open)
+{
+	char ent[8];
+
+	if (!smartypants_turn(previous_char, next_char, is_open))
+		return 0;
+
+	snprintf(ent, sizeof(ent), "&%c%cquo;", (*is_open) ? 'l' : 'r', quote);
 	bufputs(ob, ent);
 	return 1;
 }
 
-static size_t
-smartypants_cb__squote(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+/* smartypants_contraction • tells the apostrophes of 's, 't, 're... */
+static int
+smartypants_contraction(const uint8_t *text, size_t size)
 {
-	if (size >= 2) {
-		uint8_t t1 = tolower(text[1]);
+	uint8_t t1, t2;
 
-		if (t1 == '\'') {
-			if (smartypants_quotes(ob, previous_char, size >= 3 ? text[2] : 0, 'd', &smrt->in_dquote))
-				return 1;
-		}
+	if (size < 2)
+		return 0;
 
-		if ((t1 == 's' || t1 == 't' || t1 == 'm' || t1 == 'd') &&
-			(size == 3 || word_boundary(text[2]))) {
-			BUFPUTSL(ob, "&rsquo;");
-			return 0;
-		}
+	t1 = tolower(text[1]);
+	if ((t1 == 's' || t1 == 't' || t1 == 'm' || t1 == 'd') &&
+		(size == 3 || word_boundary(size > 2 ? text[2] : 0)))
+		return 1;
+
+	if (size < 3)
+		return 0;
 
-		if (size >= 3) {
-			uint8_t t2 = tolower(text[2]);
+	t2 = tolower(text[2]);
+	return ((t1 == 'r' && t2 == 'e') ||
+		(t1 == 'l' && t2 == 'l') ||
+		(t1 == 'v' && t2 == 'e')) &&
+		(size == 4 || word_boundary(size > 3 ? text[3] : 0));
+}
 
-			if (((t1 == 'r' && t2 == 'e') ||
-				(t1 == 'l' && t2 == 'l') ||
-				(t1 == 'v' && t2 == 'e')) &&
-				(size == 4 || word_boundary(text[3]))) {
-				BUFPUTSL(ob, "&rsquo;");
-				return 0;
-			}
-		}
+static size_t
+smartypants_cb__squote(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+{
+	if (size >= 2 && text[1] == '\'') {
+		if (smartypants_quotes(ob, previous_char, size >= 3 ? text[2] : 0, 'd', &smrt->in_dquote))
+			return 1;
 	}
 
-	if (smartypants_quotes(ob, previous_char, size > 0 ? text[1] : 0, 's', &smrt->in_squote))
+	if (smartypants_contraction(text, size)) {
+		BUFPUTSL(ob, "&rsquo;");
+		return 0;
+	}
+
+	if (smartypants_quotes(ob, previous_char, size > 1 ? text[1] : 0, 's', &smrt->in_squote))
 		return 0;
 
 	bufputc(ob, text[0]);
@@ -221,6 +244,10 @@ smartypants_cb__backtick(struct buf *ob, struct smartypants_data *smrt, uint8_t
 			return 1;
 	}
 
+	/* the end of a text given apart from what follows */
+	if (size < 2)
+		bufputc(ob, text[0]);
+
 	return 0;
 }
 
@@ -259,48 +286,124 @@ smartypants_cb__number(struct buf *ob, struct smartypants_data *smrt, uint8_t pr
 static size_t
 smartypants_cb__dquote(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
 {
-	if (!smartypants_quotes(ob, previous_char, size > 0 ? text[1] : 0, 'd', &smrt->in_dquote))
+	if (!smartypants_quotes(ob, previous_char, size > 1 ? text[1] : 0, 'd', &smrt->in_dquote))
 		BUFPUTSL(ob, "&quot;");
 
 	return 0;
 }
 
-static size_t
-smartypants_cb__ltag(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+/* the tags whose content is left as is, each in its skip_tag_hash slot */
+static const struct {
+	const char *name;
+	size_t size;
+} skip_tags[] = {
+	{ "math", 4 },
+	{ "code", 4 },
+	{ "pre", 3 },
+	{ "style", 5 },
+	{ "var", 3 },
+	{ "samp", 4 },
+	{ "kbd", 3 },
+	{ "script", 6 },
+};
+
+#define SKIP_TAG_MIN_LENGTH 3
+#define SKIP_TAG_MAX_LENGTH 6
+
+/* skip_tag_hash • perfect hash of the skip tags, from their length */
+/*	and first two letters */
+static inline unsigned int
+skip_tag_hash(const uint8_t *name, size_t size)
 {
-	static const char *skip_tags[] = {
-	  "pre", "code", "var", "samp", "kbd", "math", "script", "style"
+	static const unsigned char asso_values[32] = {
+		0, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 6, 0, 7, 0, 0,
+		5, 0, 2, 4, 2, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	};
-	static const size_t skip_tags_count = 8;
 
-	size_t tag, i = 0;
+	return (unsigned int)(size + asso_values[name[0] & 0x1f] + asso_values[name[1] & 0x1f]) & 7;
+}
+
+/* skip_tag • finds the skip tag opened or closed at text, as sdhtml_is_tag */
+/*	would tell, returning its slot or -1 for the other tags */
+static int
+skip_tag(const uint8_t *text, size_t size, int *closing)
+{
+	size_t i = 1, org, len;
+	unsigned int slot;
+
+	if (size < 3 || text[0] != '<')
+		return -1;
 
-	while (i < size && text[i] != '>')
+	*closing = (text[1] == '/');
+	if (*closing)
 		i++;
 
-	for (tag = 0; tag < skip_tags_count; ++tag) {
-		if (sdhtml_is_tag(text, size, skip_tags[tag]) == HTML_TAG_OPEN)
-			break;
-	}
+	org = i;
+	while (i < size && i - org <= SKIP_TAG_MAX_LENGTH && text[i] >= 'a' && text[i] <= 'z')
+		i++;
 
-	if (tag < skip_tags_count) {
-		for (;;) {
-			while (i < size && text[i] != '<')
-				i++;
+	len = i - org;
+	if (len < SKIP_TAG_MIN_LENGTH || len > SKIP_TAG_MAX_LENGTH || i == size ||
+		(!isspace(text[i]) && text[i] != '>'))
+		return -1;
+
+	slot = skip_tag_hash(text + org, len);
+	if (skip_tags[slot].size != len || memcmp(text + org, skip_tags[slot].name, len) != 0)
+		return -1;
+
+	return (int)slot;
+}
+
+/* smartypants_tag_end • finds the '>' ending the tag at text, or the */
+/*	region of a skip tag, the last char when it is left unclosed */
+static size_t
+smartypants_tag_end(const uint8_t *text, size_t size)
+{
+	const uint8_t *end;
+	size_t i, len;
+	int tag, closing;
+
+	end = memchr(text, '>', size);
+	i = end ? (size_t)(end - text) : size;
+
+	tag = skip_tag(text, size, &closing);
 
-			if (i == size)
+	if (tag >= 0 && !closing) {
+		len = skip_tags[tag].size;
+
+		/* on to the matching close tag */
+		for (;;) {
+			end = memchr(text + i, '<', size - i);
+			if (!end) {
+				i = size;
 				break;
+			}
 
-			if (sdhtml_is_tag(text + i, size - i, skip_tags[tag]) == HTML_TAG_CLOSE)
+			i = end - text;
+			if (i + len + 2 < size && text[i + 1] == '/' &&
+				memcmp(text + i + 2, skip_tags[tag].name, len) == 0 &&
+				(isspace(text[i + len + 2]) || text[i + len + 2] == '>'))
 				break;
 
 			i++;
 		}
 
-		while (i < size && text[i] != '>')
-			i++;
+		end = memchr(text + i, '>', size - i);
+		i = end ? (size_t)(end - text) : size;
 	}
 
+	/* unclosed tags run to the end of the text */
+	if (i == size)
+		i--;
+
+	return i;
+}
+
+static size_t
+smartypants_cb__ltag(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+{
+	size_t i = smartypants_tag_end(text, size);
+
 	bufput(ob, text, i + 1);
 	return i;
 }
@@ -308,8 +411,10 @@ smartypants_cb__ltag(struct buf *ob, struct smartypants_data *smrt, uint8_t prev
 static size_t
 smartypants_cb__escape(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
 {
-	if (size < 2)
+	if (size < 2) {
+		bufputc(ob, text[0]);
 		return 0;
+	}
 
 	switch (text[1]) {
 	case '\\':
@@ -357,33 +462,537 @@ static struct {
 };
 #endif
 
+int
+sdhtml_smartypants_tag(const uint8_t *tag_data, size_t tag_size)
+{
+	int tag, closing;
+
+	tag = skip_tag(tag_data, tag_size, &closing);
+	if (tag < 0)
+		return 0;
+
+	return closing ? -tag - 1 : tag + 1;
+}
+
 void
-sdhtml_smartypants(struct buf *ob, const uint8_t *text, size_t size)
+sdhtml_smartypants_escape(struct buf *ob, struct smartypants_data *smrt,
+	uint8_t previous_char, const uint8_t *text, size_t size)
 {
 	size_t i;
-	struct smartypants_data smrt = {0, 0};
 
-	if (!text)
-		return;
-
-	bufgrow(ob, size);
+	bufgrow(ob, ob->size + size);
 
 	for (i = 0; i < size; ++i) {
+		size_t org;
+		uint8_t previous;
+
+		org = i;
+		while (i < size && smartypants_cb_chars[text[i]] == 0 && text[i] != '>')
+			i++;
+
+		if (i > org)
+			bufput(ob, text + org, i - org);
+
+		if (i >= size)
+			break;
+
+		/* the text around escaped chars is the same to word_boundary
+		 * as the entities sdhtml_smartypants would see */
+		previous = i ? text[i - 1] : previous_char;
+
+		switch (text[i]) {
+		case '<':
+			BUFPUTSL(ob, "&lt;");
+			break;
+
+		case '>':
+			BUFPUTSL(ob, "&gt;");
+			break;
+
+		case '&':
+			BUFPUTSL(ob, "&amp;");
+			break;
+
+		case '\'':
+			BUFPUTSL(ob, "&#39;");
+			break;
+
+		case '"':
+			if (!smartypants_quotes(ob, previous, i + 1 < size ? text[i + 1] : 0, 'd', &smrt->in_dquote))
+				BUFPUTSL(ob, "&quot;");
+			break;
+
+		case '\\':
+			/* escaped quotes do not follow a backslash once escaped */
+			if (i + 1 < size && (text[i + 1] == '"' || text[i + 1] == '\'')) {
+				bufputc(ob, '\\');
+				break;
+			}
+			/* fall through */
+
+		default:
+			i += smartypants_cb_ptrs[(int)smartypants_cb_chars[text[i]]]
+				(ob, smrt, previous, text + i, size - i);
+			break;
+		}
+	}
+}
+
+/* smartypants_run • makes the substitutions of text[i, end), end being */
+/*	where a substitution or a tag may start */
+static void
+smartypants_run(struct buf *ob, struct smartypants_data *smrt,
+	const uint8_t *text, size_t i, size_t end, size_t size)
+{
+	for (; i < end; ++i) {
 		size_t org;
 		uint8_t action = 0;
 
 		org = i;
-		while (i < size && (action = smartypants_cb_chars[text[i]]) == 0)
+		while (i < end && (action = smartypants_cb_chars[text[i]]) == 0)
 			i++;
 
 		if (i > org)
 			bufput(ob, text + org, i - org);
 
-		if (i < size) {
+		if (i < end) {
 			i += smartypants_cb_ptrs[(int)action]
-				(ob, &smrt, i ? text[i - 1] : 0, text + i, size - i);
+				(ob, smrt, i ? text[i - 1] : 0, text + i, size - i);
 		}
 	}
 }
 
+void
+sdhtml_smartypants(struct buf *ob, const uint8_t *text, size_t size)
+{
+	struct smartypants_data smrt = {0, 0};
+
+	if (!text)
+		return;
+
+	bufgrow(ob, size);
+	smartypants_run(ob, &smrt, text, 0, size, size);
+}
+
+/* where a stream stands between two parts of the text */
+enum {
+	SMARTYPANTS_STREAM_TEXT = 0,
+	SMARTYPANTS_STREAM_TAG,			/* in a tag, up to its '>' */
+	SMARTYPANTS_STREAM_SKIP_OPEN,	/* in the opening skip tag */
+	SMARTYPANTS_STREAM_SKIP,		/* in the content of a skip tag */
+	SMARTYPANTS_STREAM_SKIP_CLOSE,	/* in the closing skip tag */
+};
+
+/* smartypants_stream_run • makes the substitutions of the text the way */
+/*	smartypants_run would, but stops before a substitution or tag that */
+/*	may go on past the text unless it is the last one; returns the */
+/*	length done, the rest being shorter than SMARTYPANTS_LOOKAHEAD */
+static size_t
+smartypants_stream_run(struct buf *ob, struct smartypants_stream *stream,
+	const uint8_t *text, size_t size, int last)
+{
+	const uint8_t *end;
+	size_t i = 0, org, len;
+	uint8_t action;
+	int tag, closing;
+
+	while (i < size) {
+		org = i;
+
+		switch (stream->state) {
+		case SMARTYPANTS_STREAM_TAG:
+		case SMARTYPANTS_STREAM_SKIP_OPEN:
+		case SMARTYPANTS_STREAM_SKIP_CLOSE:
+			end = memchr(text + i, '>', size - i);
+			i = end ? (size_t)(end - text) + 1 : size;
+			if (i > org)
+				bufput(ob, text + org, i - org);
+
+			if (end)
+				stream->state = (stream->state == SMARTYPANTS_STREAM_SKIP_OPEN) ?
+					SMARTYPANTS_STREAM_SKIP : SMARTYPANTS_STREAM_TEXT;
+			break;
+
+		case SMARTYPANTS_STREAM_SKIP:
+			len = skip_tags[stream->skip_tag].size;
+
+			for (;;) {
+				end = memchr(text + i, '<', size - i);
+				if (!end) {
+					i = size;
+					break;
+				}
+
+				i = end - text;
+				if (i + len + 2 >= size) {
+					/* the rest is left as is if nothing follows */
+					if (last)
+						i = size;
+					break;
+				}
+
+				if (text[i + 1] == '/' &&
+					memcmp(text + i + 2, skip_tags[stream->skip_tag].name, len) == 0 &&
+					(isspace(text[i + len + 2]) || text[i + len + 2] == '>')) {
+					stream->state = SMARTYPANTS_STREAM_SKIP_CLOSE;
+					break;
+				}
 
+				i++;
+			}
+
+			if (i > org)
+				bufput(ob, text + org, i - org);
+			if (i < size && stream->state == SMARTYPANTS_STREAM_SKIP)
+				goto held;
+			break;
+
+		default:
+			action = 0;
+			while (i < size && (action = smartypants_cb_chars[text[i]]) == 0)
+				i++;
+
+			if (i > org)
+				bufput(ob, text + org, i - org);
+			if (i >= size)
+				break;
+
+			if (!last && size - i < SMARTYPANTS_LOOKAHEAD)
+				goto held;
+
+			if (text[i] == '<') {
+				tag = skip_tag(text + i, size - i, &closing);
+				if (tag >= 0 && !closing) {
+					stream->skip_tag = tag;
+					stream->state = SMARTYPANTS_STREAM_SKIP_OPEN;
+				} else {
+					stream->state = SMARTYPANTS_STREAM_TAG;
+				}
+				break;
+			}
+
+			i += smartypants_cb_ptrs[(int)action]
+				(ob, &stream->data, i ? text[i - 1] : stream->previous_char, text + i, size - i);
+			i++;
+			break;
+		}
+	}
+
+held:
+	if (i > 0)
+		stream->previous_char = text[i - 1];
+
+	return i;
+}
+
+void
+sdhtml_smartypants_init(struct smartypants_stream *stream)
+{
+	memset(stream, 0x0, sizeof(struct smartypants_stream));
+}
+
+void
+sdhtml_smartypants_feed(struct buf *ob, struct smartypants_stream *stream,
+	const uint8_t *text, size_t size)
+{
+	uint8_t window[2 * SMARTYPANTS_LOOKAHEAD];
+	size_t done, n;
+
+	if (!text || !size)
+		return;
+
+	/* what was held back goes first, with enough of the text to be done */
+	if (stream->pending_size) {
+		n = (size < SMARTYPANTS_LOOKAHEAD) ? size : SMARTYPANTS_LOOKAHEAD;
+		memcpy(window, stream->pending, stream->pending_size);
+		memcpy(window + stream->pending_size, text, n);
+		n += stream->pending_size;
+
+		done = smartypants_stream_run(ob, stream, window, n, 0);
+		if (done < stream->pending_size) {
+			/* all the text is in the window */
+			stream->pending_size = n - done;
+			memmove(stream->pending, window + done, stream->pending_size);
+			return;
+		}
+
+		text += done - stream->pending_size;
+		size -= done - stream->pending_size;
+		stream->pending_size = 0;
+	}
+
+	done = smartypants_stream_run(ob, stream, text, size, 0);
+	stream->pending_size = size - done;
+	memcpy(stream->pending, text + done, stream->pending_size);
+}
+
+void
+sdhtml_smartypants_finish(struct buf *ob, struct smartypants_stream *stream)
+{
+	smartypants_stream_run(ob, stream, stream->pending, stream->pending_size, 1);
+	sdhtml_smartypants_init(stream);
+}
+
+/* chars that may change the quote state or hide others from smartypants_run */
+static const uint8_t smartypants_scan_chars[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/* smartypants_scan • follows the quote state through text[i, end) the way */
+/*	smartypants_run would, without output; returns where it stops, past */
+/*	end when a tag runs over it */
+static size_t
+smartypants_scan(struct smartypants_data *smrt,
+	const uint8_t *text, size_t i, size_t end, size_t size)
+{
+	const uint8_t *t;
+	uint8_t previous;
+	size_t rest;
+
+	for (; i < end; ++i) {
+		while (i < end && smartypants_scan_chars[text[i]] == 0)
+			i++;
+
+		if (i >= end)
+			break;
+
+		t = text + i;
+		rest = size - i;
+		previous = i ? text[i - 1] : 0;
+
+		switch (t[0]) {
+		case '<':
+			i += smartypants_tag_end(t, rest);
+			break;
+
+		case '\\':
+			if (rest >= 2 && (t[1] == '\\' || t[1] == '"' || t[1] == '\'' ||
+				t[1] == '.' || t[1] == '-' || t[1] == '`'))
+				i++;
+			break;
+
+		case '"':
+			smartypants_turn(previous, rest > 1 ? t[1] : 0, &smrt->in_dquote);
+			break;
+
+		case '&':
+			if (rest >= 6 && memcmp(t, "&quot;", 6) == 0 &&
+				smartypants_turn(previous, rest >= 7 ? t[6] : 0, &smrt->in_dquote))
+				i += 5;
+			break;
+
+		case '`':
+			if (rest >= 2 && t[1] == '`' &&
+				smartypants_turn(previous, rest >= 3 ? t[2] : 0, &smrt->in_dquote))
+				i++;
+			break;
+
+		case '\'':
+			if (rest >= 2 && t[1] == '\'' &&
+				smartypants_turn(previous, rest >= 3 ? t[2] : 0, &smrt->in_dquote)) {
+				i++;
+				break;
+			}
+
+			if (!smartypants_contraction(t, rest))
+				smartypants_turn(previous, rest > 1 ? t[1] : 0, &smrt->in_squote);
+			break;
+		}
+	}
+
+	return i;
+}
+
+/* smartypants_split • finds where a block tag starts a line after from, */
+/*	size when there is none */
+static size_t
+smartypants_split(const uint8_t *text, size_t from, size_t size)
+{
+	static const char *block_tags[] = {
+		"p", "h1", "h2", "h3", "h4", "h5", "h6", "ul", "ol", "li",
+		"dl", "div", "pre", "table", "blockquote", "hr"
+	};
+	static const size_t block_tags_count = 16;
+
+	const uint8_t *nl;
+	size_t i = from, tag;
+
+	while (i < size) {
+		nl = memchr(text + i, '\n', size - i);
+		if (!nl)
+			break;
+
+		i = nl - text + 1;
+		if (i >= size || text[i] != '<')
+			continue;
+
+		for (tag = 0; tag < block_tags_count; ++tag) {
+			if (sdhtml_is_tag(text + i, size - i, block_tags[tag]) == HTML_TAG_OPEN)
+				return i;
+		}
+	}
+
+	return size;
+}
+
+struct smartypants_chunk {
+	const uint8_t *text;
+	size_t size;		/* of the whole text */
+	size_t start, end;
+	size_t stop;		/* where the scan of the chunk stops */
+
+	/* quote state after the chunk, for every state before it, as */
+	/* indexed by SMARTYPANTS_STATE */
+	struct smartypants_data exit[4];
+	struct smartypants_data entry;
+
+	struct buf *ob;
+	int scanning;
+};
+
+#define SMARTYPANTS_STATE(smrt) ((smrt)->in_squote | ((smrt)->in_dquote << 1))
+
+static void *
+smartypants_chunk(void *opaque)
+{
+	struct smartypants_chunk *chunk = opaque;
+	int state;
+
+	if (chunk->scanning) {
+		for (state = 0; state < 4; ++state) {
+			chunk->exit[state].in_squote = state & 1;
+			chunk->exit[state].in_dquote = state >> 1;
+			chunk->stop = smartypants_scan(&chunk->exit[state],
+				chunk->text, chunk->start, chunk->end, chunk->size);
+		}
+	} else {
+		smartypants_run(chunk->ob, &chunk->entry,
+			chunk->text, chunk->start, chunk->end, chunk->size);
+	}
+
+	return NULL;
+}
+
+/* smartypants_parallel • runs every chunk but the first in a thread of */
+/*	its own, falling back to the calling thread */
+static void
+smartypants_parallel(struct smartypants_chunk *chunks, size_t count)
+{
+#if defined(_WIN32)
+	size_t i;
+
+	for (i = 0; i < count; ++i)
+		smartypants_chunk(&chunks[i]);
+#else
+	pthread_t threads[SMARTYPANTS_THREADS_MAX];
+	int started[SMARTYPANTS_THREADS_MAX];
+	size_t i;
+
+	for (i = 1; i < count; ++i)
+		started[i] = (pthread_create(&threads[i], NULL, smartypants_chunk, &chunks[i]) == 0);
+
+	smartypants_chunk(&chunks[0]);
+
+	for (i = 1; i < count; ++i) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+		else
+			smartypants_chunk(&chunks[i]);
+	}
+#endif
+}
+
+void
+sdhtml_smartypants_parallel(struct buf *ob, const uint8_t *text, size_t size, int threads)
+{
+	struct smartypants_chunk chunks[SMARTYPANTS_THREADS_MAX];
+	size_t count = 0, i, start = 0, wanted;
+
+	if (!text)
+		return;
+
+#if !defined(_WIN32) && defined(_SC_NPROCESSORS_ONLN)
+	/* the prescan only pays off with a core for each thread */
+	{
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		if (cpus > 0 && threads > cpus)
+			threads = (int)cpus;
+	}
+#endif
+
+	wanted = size / SMARTYPANTS_CHUNK_MIN;
+	if (threads <= 1)
+		wanted = 1;
+	else if (wanted > (size_t)threads)
+		wanted = threads;
+
+	if (wanted > SMARTYPANTS_THREADS_MAX)
+		wanted = SMARTYPANTS_THREADS_MAX;
+
+	if (wanted <= 1) {
+		sdhtml_smartypants(ob, text, size);
+		return;
+	}
+
+	/* chunks start at block tags, found past even shares of the text */
+	while (start < size && count < wanted) {
+		struct smartypants_chunk *chunk = &chunks[count++];
+
+		chunk->text = text;
+		chunk->size = size;
+		chunk->start = start;
+		chunk->end = (count < wanted) ? smartypants_split(text,
+			(size / wanted * count > start) ? size / wanted * count : start, size) : size;
+		chunk->scanning = 1;
+
+		start = chunk->end;
+	}
+
+	smartypants_parallel(chunks, count);
+
+	/* a tag running over the end of its chunk joins it with the next */
+	for (i = 0; i + 1 < count; ) {
+		if (chunks[i].stop <= chunks[i].end) {
+			i++;
+			continue;
+		}
+
+		chunks[i].end = chunks[i + 1].end;
+		memmove(&chunks[i + 1], &chunks[i + 2], (count - i - 2) * sizeof(struct smartypants_chunk));
+		count--;
+		smartypants_chunk(&chunks[i]);
+	}
+
+	/* the quote state each chunk starts with, then the substitutions */
+	memset(&chunks[0].entry, 0x0, sizeof(struct smartypants_data));
+	for (i = 0; i < count; ++i) {
+		if (i > 0)
+			chunks[i].entry = chunks[i - 1].exit[SMARTYPANTS_STATE(&chunks[i - 1].entry)];
+
+		chunks[i].scanning = 0;
+		chunks[i].ob = i ? bufnew(64) : ob;
+		bufgrow(chunks[i].ob, chunks[i].ob->size + chunks[i].end - chunks[i].start);
+	}
+
+	smartypants_parallel(chunks, count);
+
+	for (i = 1; i < count; ++i) {
+		bufput(ob, chunks[i].ob->data, chunks[i].ob->size);
+		bufrelease(chunks[i].ob);
+	}
+}
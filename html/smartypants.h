@@ -0,0 +1,29 @@
+#ifndef SMARTYPANTS_H__
+#define SMARTYPANTS_H__
+
+#include "html.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* SmartyPants as the HTML renderer applies it while rendering, shared */
+/* between html.c and html_smartypants.c and not exported */
+
+/* sdhtml_smartypants_escape - escapes text as HTML with the substitutions */
+/* sdhtml_smartypants would make in it, following previous_char and the */
+/* state left by the text before */
+extern void
+sdhtml_smartypants_escape(struct buf *ob, struct smartypants_data *smrt,
+	uint8_t previous_char, const uint8_t *text, size_t size);
+
+/* sdhtml_smartypants_tag - index + 1 of the tag whose content SmartyPants */
+/* leaves alone, negated for closing tags, 0 for the other tags */
+extern int
+sdhtml_smartypants_tag(const uint8_t *tag_data, size_t tag_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,690 @@
+/* analysis.c - headers, links, images and words of a document, found */
+/* without rendering it */
+
+/*
+ * Copyright (c) 2011, Vicent Marti
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "analysis.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+#define ANALYSIS_DATA_UNIT 1024
+
+/* bytes of the document the searches may read, for each byte of it */
+#define ANALYSIS_SEARCH_WORK 16
+
+/* analysis_push • appends a cleared entry, NULL when the list cannot grow */
+static struct sd_analysis_entry *
+analysis_push(struct sd_analysis_list *list)
+{
+	struct sd_analysis_entry *entry;
+
+	if (list->size >= list->asize) {
+		size_t asize = list->asize ? list->asize * 2 : 16;
+		void *items = realloc(list->items, asize * sizeof(struct sd_analysis_entry));
+
+		if (!items)
+			return NULL;
+
+		list->items = items;
+		list->asize = asize;
+	}
+
+	entry = &list->items[list->size++];
+	memset(entry, 0x0, sizeof(struct sd_analysis_entry));
+	entry->offset = SD_ANALYSIS_NONE;
+	return entry;
+}
+
+/* analysis_store • copies a text into the data of the analysis */
+static void
+analysis_store(struct sd_analysis *an, size_t *offset, size_t *size,
+	const uint8_t *data, size_t data_size)
+{
+	*offset = an->data->size;
+	if (data && data_size)
+		bufput(an->data, data, data_size);
+	*size = an->data->size - *offset;
+}
+
+/* analysis_match • whether key is read in the document at i; a run of */
+/*	spaces in key matches one with tabs, which the parser expands */
+static int
+analysis_match(const uint8_t *doc, size_t doc_size, size_t i, const uint8_t *key, size_t size)
+{
+	size_t j = 0, key_spaces, doc_spaces;
+	int tabs;
+
+	while (j < size) {
+		if (i >= doc_size)
+			return 0;
+
+		if (key[j] == ' ' && (doc[i] == ' ' || doc[i] == '\t')) {
+			for (key_spaces = 0; j < size && key[j] == ' '; j++)
+				key_spaces++;
+
+			for (doc_spaces = 0, tabs = 0; i < doc_size &&
+				(doc[i] == ' ' || doc[i] == '\t'); i++, doc_spaces++)
+				tabs |= (doc[i] == '\t');
+
+			if (!tabs && key_spaces != doc_spaces)
+				return 0;
+		} else if (doc[i++] != key[j++]) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/* analysis_spend • takes work from what is left for the searches, */
+/*	returning 0 once it has run out */
+static int
+analysis_spend(struct sd_analysis *an, size_t work)
+{
+	if (work >= an->search_left) {
+		an->search_left = 0;
+		return 0;
+	}
+
+	an->search_left -= work;
+	return 1;
+}
+
+/* analysis_search • where the first line of key appears in the document */
+/*	after prefix, from i on; returns the offset of prefix, or */
+/*	SD_ANALYSIS_NONE */
+static size_t
+analysis_search(struct sd_analysis *an, size_t i, const char *prefix, const uint8_t *key, size_t size)
+{
+	const uint8_t *doc = an->document, *found;
+	size_t prefix_size = strlen(prefix), left;
+	uint8_t first;
+
+	found = memchr(key, '\n', size);
+	if (found)
+		size = found - key;
+
+	if (prefix_size + size == 0 || prefix_size + size > an->doc_size)
+		return SD_ANALYSIS_NONE;
+
+	first = prefix_size ? (uint8_t)prefix[0] : key[0];
+
+	for (; i < an->doc_size; ++i) {
+		left = an->doc_size - i;
+		if (left > an->search_left)
+			left = an->search_left;
+
+		found = memchr(doc + i, first, left);
+		if (!analysis_spend(an, found ? (size_t)(found - doc) - i : left) || !found)
+			break;
+
+		i = found - doc;
+		if (!analysis_spend(an, prefix_size + size))
+			break;
+
+		if (memcmp(doc + i, prefix, prefix_size) == 0 &&
+			analysis_match(doc, an->doc_size, i + prefix_size, key, size))
+			return i;
+	}
+
+	return SD_ANALYSIS_NONE;
+}
+
+/* analysis_find • analysis_search from the last element found on, which */
+/*	becomes the one found */
+static size_t
+analysis_find(struct sd_analysis *an, const char *prefix, const uint8_t *key, size_t size)
+{
+	size_t i = analysis_search(an, an->cursor, prefix, key, size);
+
+	if (i != SD_ANALYSIS_NONE)
+		an->cursor = i;
+
+	return i;
+}
+
+/* analysis_prefix • skips the quote and list markers starting a line */
+static size_t
+analysis_prefix(const uint8_t *doc, size_t end, size_t i)
+{
+	while (i < end) {
+		if (doc[i] == ' ' || doc[i] == '\t' || doc[i] == '>')
+			i++;
+		else if ((doc[i] == '*' || doc[i] == '+' || doc[i] == '-') &&
+			i + 1 < end && (doc[i + 1] == ' ' || doc[i + 1] == '\t'))
+			i += 2;
+		else if (isdigit(doc[i])) {
+			size_t j = i;
+
+			while (j < end && isdigit(doc[j]))
+				j++;
+
+			if (j + 1 >= end || doc[j] != '.' || (doc[j + 1] != ' ' && doc[j + 1] != '\t'))
+				break;
+
+			i = j + 2;
+		} else
+			break;
+	}
+
+	return i;
+}
+
+/* analysis_headerline • start of the line holding offset when it is a */
+/*	header of the level given, with offset past its '#' or the line */
+/*	underlined; SD_ANALYSIS_NONE otherwise, with *next set to where the */
+/*	words may be looked for again */
+static size_t
+analysis_headerline(struct sd_analysis *an, size_t offset, int level, size_t *next)
+{
+	const uint8_t *doc = an->document;
+	size_t line = offset, end = offset, i;
+	int hashes = 0;
+	uint8_t c;
+
+	while (line > 0 && doc[line - 1] != '\n' && doc[line - 1] != '\r')
+		line--;
+
+	while (end < an->doc_size && doc[end] != '\n' && doc[end] != '\r')
+		end++;
+
+	if (!analysis_spend(an, end - line)) {
+		*next = an->doc_size;
+		return SD_ANALYSIS_NONE;
+	}
+
+	/* the words may be found again past the markers starting the line */
+	i = analysis_prefix(doc, end, line);
+	for (*next = i; *next < end && doc[*next] == '#' && *next - i < 6; (*next)++);
+
+	if (offset >= *next)
+		*next = end;
+
+	/* atx header */
+	i = analysis_prefix(doc, offset, line);
+	while (i < offset && doc[i] == '#' && hashes < 6) {
+		hashes++;
+		i++;
+	}
+
+	if (hashes)
+		return hashes == level ? line : SD_ANALYSIS_NONE;
+
+	/* setext header, underlined on the next line */
+	if (end < an->doc_size && doc[end] == '\r')
+		end++;
+	if (end < an->doc_size && doc[end] == '\n')
+		end++;
+
+	for (i = end; i < an->doc_size && (doc[i] == ' ' || doc[i] == '>'); ++i);
+
+	if (i >= an->doc_size || (doc[i] != '=' && doc[i] != '-'))
+		return SD_ANALYSIS_NONE;
+
+	c = doc[i];
+	while (i < an->doc_size && doc[i] == c)
+		i++;
+
+	while (i < an->doc_size && doc[i] == ' ')
+		i++;
+
+	if (i < an->doc_size && doc[i] != '\n' && doc[i] != '\r')
+		return SD_ANALYSIS_NONE;
+
+	return level == (c == '=' ? 1 : 2) ? line : SD_ANALYSIS_NONE;
+}
+
+/* analysis_words • counts the words starting in text, which may go on */
+/*	from the previous one */
+static void
+analysis_words(struct sd_analysis *an, const uint8_t *text, size_t size)
+{
+	size_t i;
+
+	for (i = 0; i < size; ++i) {
+		if (isspace(text[i])) {
+			an->in_word = 0;
+			continue;
+		}
+
+		if (!an->in_word)
+			an->words++;
+
+		an->in_word++;
+	}
+}
+
+/* analysis_header • finds the header being read from its first words, */
+/*	given as they are in the markdown, back to the start of its line */
+static void
+analysis_header(struct sd_analysis *an, const uint8_t *text, size_t size)
+{
+	struct sd_analysis_entry *header;
+	size_t i, offset, next;
+
+	if (an->header == SD_ANALYSIS_NONE)
+		return;
+
+	header = &an->headers.items[an->header];
+	for (i = 0; i < size && isspace(text[i]); ++i);
+
+	if (header->offset != SD_ANALYSIS_NONE || i == size)
+		return;
+
+	/* the words may come earlier in the text, the line must be the header */
+	offset = an->cursor;
+	while ((offset = analysis_search(an, offset, "", text + i, size - i)) != SD_ANALYSIS_NONE) {
+		header->offset = analysis_headerline(an, offset, header->flags, &next);
+		if (header->offset != SD_ANALYSIS_NONE) {
+			an->cursor = offset;
+			return;
+		}
+		offset = next;
+	}
+}
+
+/* analysis_text • visible text: counted, and kept when a header or link */
+/*	is being read */
+static void
+analysis_text(struct sd_analysis *an, const uint8_t *text, size_t size)
+{
+	analysis_words(an, text, size);
+
+	if (size && (an->header != SD_ANALYSIS_NONE || an->link != SD_ANALYSIS_NONE))
+		bufput(an->text, text, size);
+}
+
+/* analysis_link • adds a link whose text is known at once */
+static void
+analysis_link(struct sd_analysis *an, const struct buf *link, const struct buf *text, int type)
+{
+	struct sd_analysis_entry *entry = analysis_push(&an->links);
+
+	if (!entry)
+		return;
+
+	entry->flags = type;
+	entry->offset = analysis_find(an, "", text->data, text->size);
+
+	entry->link = an->data->size;
+	if (type == MKDA_EMAIL && bufprefix(link, "mailto:") != 0)
+		BUFPUTSL(an->data, "mailto:");
+	bufput(an->data, link->data, link->size);
+	entry->link_size = an->data->size - entry->link;
+
+	analysis_store(an, &entry->text, &entry->text_size, text->data, text->size);
+}
+
+static int
+analysis_enter(struct buf *ob, const struct sd_node *node, void *opaque)
+{
+	struct sd_analysis *an = opaque;
+	struct sd_analysis_entry *entry;
+
+	if (node->type < SD_NODE_EMPHASIS)
+		an->in_word = 0;
+
+	switch (node->type) {
+	case SD_NODE_HEADER:
+		entry = analysis_push(&an->headers);
+		if (entry) {
+			entry->flags = node->flags;
+			an->header = an->headers.size - 1;
+		}
+		break;
+
+	case SD_NODE_LINK:
+		entry = analysis_push(&an->links);
+		if (entry) {
+			entry->offset = analysis_find(an, "", node->source, node->source_size);
+			an->link = an->links.size - 1;
+			an->link_start = an->text->size;
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	return 1;
+}
+
+static int
+analysis_leave(struct buf *ob, const struct sd_node *node, void *opaque)
+{
+	struct sd_analysis *an = opaque;
+	struct sd_analysis_entry *entry;
+
+	if (node->type < SD_NODE_EMPHASIS)
+		an->in_word = 0;
+
+	switch (node->type) {
+	case SD_NODE_HEADER:
+		if (an->header == SD_ANALYSIS_NONE)
+			break;
+
+		entry = &an->headers.items[an->header];
+		analysis_store(an, &entry->text, &entry->text_size, an->text->data, an->text->size);
+
+		an->header = SD_ANALYSIS_NONE;
+		an->text->size = 0;
+		break;
+
+	case SD_NODE_LINK:
+		if (an->link == SD_ANALYSIS_NONE)
+			break;
+
+		entry = &an->links.items[an->link];
+		if (node->link)
+			analysis_store(an, &entry->link, &entry->link_size, node->link->data, node->link->size);
+		analysis_store(an, &entry->text, &entry->text_size,
+			an->text->data + an->link_start, an->text->size - an->link_start);
+
+		/* the text stays for the header around */
+		if (an->header == SD_ANALYSIS_NONE)
+			an->text->size = an->link_start;
+		an->link = SD_ANALYSIS_NONE;
+		break;
+
+	default:
+		break;
+	}
+
+	return 1;
+}
+
+/* analysis_block • enables a block, its content comes between enter and leave */
+static void
+analysis_block(struct buf *ob, const struct buf *text, void *opaque)
+{
+}
+
+static void
+analysis_block_flags(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+}
+
+static void
+analysis_table(struct buf *ob, const struct buf *header, const struct buf *body, void *opaque)
+{
+}
+
+/* analysis_skip • moves past the lines of a block left unparsed, so that */
+/*	the elements after it are not found in its text */
+static void
+analysis_skip(struct sd_analysis *an, const struct buf *text)
+{
+	size_t beg = 0, end, i, offset;
+
+	while (beg < text->size) {
+		for (end = beg; end < text->size && text->data[end] != '\n'; end++);
+		for (i = beg; i < end && isspace(text->data[i]); i++);
+
+		if (i < end) {
+			offset = analysis_find(an, "", text->data + i, end - i);
+			if (offset == SD_ANALYSIS_NONE)
+				return;
+
+			an->cursor = offset + 1;
+		}
+
+		beg = end + 1;
+	}
+}
+
+static void
+analysis_blockcode(struct buf *ob, const struct buf *text, const struct buf *lang, void *opaque)
+{
+	analysis_skip(opaque, text);
+}
+
+static void
+analysis_blockhtml(struct buf *ob, const struct buf *text, void *opaque)
+{
+	analysis_skip(opaque, text);
+}
+
+/* analysis_span • enables a span, its content comes between enter and leave */
+static int
+analysis_span(struct buf *ob, const struct buf *text, void *opaque)
+{
+	return 1;
+}
+
+static int
+analysis_autolink(struct buf *ob, const struct buf *link, enum mkd_autolink type, void *opaque)
+{
+	struct sd_analysis *an = opaque;
+	struct buf text = { 0, 0, 0, 0 };
+
+	if (!link || !link->size)
+		return 0;
+
+	text.data = link->data;
+	text.size = link->size;
+	if (bufprefix(link, "mailto:") == 0) {
+		text.data += 7;
+		text.size -= 7;
+	}
+
+	analysis_link(an, link, &text, type);
+	analysis_words(an, text.data, text.size);
+	return 1;
+}
+
+static int
+analysis_codespan(struct buf *ob, const struct buf *text, void *opaque)
+{
+	if (text) {
+		analysis_header(opaque, text->data, text->size);
+		analysis_text(opaque, text->data, text->size);
+	}
+	return 1;
+}
+
+static int
+analysis_image(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *alt, void *opaque)
+{
+	struct sd_analysis *an = opaque;
+	struct sd_analysis_entry *entry;
+
+	/* the '!' came as text, and is no word of its own */
+	if (an->text->size && an->text->data[an->text->size - 1] == '!' &&
+		(an->header != SD_ANALYSIS_NONE || an->link != SD_ANALYSIS_NONE))
+		an->text->size--;
+
+	if (an->in_word == 1) {
+		an->words--;
+		an->in_word = 0;
+	}
+
+	entry = analysis_push(&an->images);
+	if (!entry)
+		return 1;
+
+	if (alt) {
+		entry->offset = analysis_find(an, "![", alt->data, alt->size);
+		analysis_store(an, &entry->text, &entry->text_size, alt->data, alt->size);
+	} else {
+		entry->offset = analysis_find(an, "![", NULL, 0);
+		entry->text = an->data->size;
+	}
+
+	if (link)
+		analysis_store(an, &entry->link, &entry->link_size, link->data, link->size);
+	return 1;
+}
+
+/* analysis_link_text • a link without parsed content: a "www." autolink, */
+/*	whose text went through analysis_normal_text */
+static int
+analysis_link_text(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *content, void *opaque)
+{
+	struct buf text = { 0, 0, 0, 0 };
+
+	if (!link || !content)
+		return 0;
+
+	/* the text was not rendered, it is the link without its scheme */
+	text.data = link->data;
+	text.size = link->size;
+	if (!content->size && bufprefix(link, "http://") == 0) {
+		text.data += 7;
+		text.size -= 7;
+	}
+
+	analysis_link(opaque, link, &text, MKDA_NORMAL);
+	return 1;
+}
+
+static int
+analysis_raw_html(struct buf *ob, const struct buf *tag, void *opaque)
+{
+	return 1;
+}
+
+/* analysis_entity • named entities are decoded, the others kept as is */
+static void
+analysis_entity(struct buf *ob, const struct buf *entity, void *opaque)
+{
+	const char *value = NULL;
+
+	analysis_header(opaque, entity->data, entity->size);
+
+	if (entity->size > 2 && entity->data[1] != '#')
+		value = sd_html_entity(entity->data + 1, entity->size - 2);
+
+	if (value)
+		analysis_text(opaque, (const uint8_t *)value, strlen(value));
+	else
+		analysis_text(opaque, entity->data, entity->size);
+}
+
+static void
+analysis_normal_text(struct buf *ob, const struct buf *text, void *opaque)
+{
+	analysis_header(opaque, text->data, text->size);
+	analysis_text(opaque, text->data, text->size);
+}
+
+struct sd_analysis *
+sd_analysis_new(void)
+{
+	struct sd_analysis *an;
+
+	an = calloc(1, sizeof(struct sd_analysis));
+	if (!an)
+		return NULL;
+
+	an->data = bufnew(ANALYSIS_DATA_UNIT);
+	an->text = bufnew(64);
+	an->ob = bufnew(64);
+
+	if (!an->data || !an->text || !an->ob) {
+		sd_analysis_free(an);
+		return NULL;
+	}
+
+	an->header = an->link = SD_ANALYSIS_NONE;
+	return an;
+}
+
+void
+sd_analysis_free(struct sd_analysis *an)
+{
+	if (!an)
+		return;
+
+	free(an->headers.items);
+	free(an->links.items);
+	free(an->images.items);
+	bufrelease(an->data);
+	bufrelease(an->text);
+	bufrelease(an->ob);
+	free(an);
+}
+
+void
+sd_analysis_renderer(struct sd_callbacks *callbacks)
+{
+	static const struct sd_callbacks cb_default = {
+		analysis_blockcode,
+		analysis_block,
+		analysis_blockhtml,
+		analysis_block_flags,
+		NULL,
+		analysis_block_flags,
+		analysis_block_flags,
+		analysis_block,
+		analysis_table,
+		analysis_block,
+		analysis_block_flags,
+
+		analysis_autolink,
+		analysis_codespan,
+		analysis_span,
+		analysis_span,
+		analysis_image,
+		NULL,
+		analysis_link_text,
+		analysis_raw_html,
+		analysis_span,
+		analysis_span,
+		analysis_span,
+
+		analysis_entity,
+		analysis_normal_text,
+
+		NULL,
+		NULL,
+
+		NULL,
+		NULL,
+
+		analysis_enter,
+		analysis_leave,
+	};
+
+	memcpy(callbacks, &cb_default, sizeof(struct sd_callbacks));
+}
+
+void
+sd_analyze(struct sd_analysis *an, struct sd_markdown *md,
+	const uint8_t *document, size_t doc_size)
+{
+	an->headers.size = 0;
+	an->links.size = 0;
+	an->images.size = 0;
+	an->words = 0;
+	an->data->size = 0;
+
+	an->document = document;
+	an->doc_size = doc_size;
+	an->cursor = 0;
+	an->search_left = doc_size * ANALYSIS_SEARCH_WORK;
+	an->header = an->link = SD_ANALYSIS_NONE;
+	an->in_word = 0;
+	an->text->size = 0;
+	an->ob->size = 0;
+
+	sd_markdown_render(an->ob, document, doc_size, md);
+
+	an->document = NULL;
+	an->doc_size = 0;
+}
@@ -0,0 +1,104 @@
+/* analysis.h - headers, links, images and words of a document, found */
+/* without rendering it */
+
+/*
+ * Copyright (c) 2011, Vicent Marti
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef UPSKIRT_ANALYSIS_H
+#define UPSKIRT_ANALYSIS_H
+
+#include "markdown.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* no offset in the document */
+#define SD_ANALYSIS_NONE ((size_t)-1)
+
+/* sd_analysis_entry - a header, link or image; its texts are slices of */
+/* the data of the analysis */
+struct sd_analysis_entry {
+	size_t offset;		/* start of the element in the document, or of */
+						/* the line of a header; SD_ANALYSIS_NONE where */
+						/* it cannot be matched exactly, as when the */
+						/* parser rewrote it, or the search through */
+						/* the document took too long */
+	int flags;			/* header level, autolink type of links */
+	size_t text;		/* header text, link text or image alt */
+	size_t text_size;
+	size_t link;		/* link target, unescaped and resolved from its */
+	size_t link_size;	/* reference, mailto: added to e-mail addresses */
+};
+
+/* sd_analysis_list - entries in document order */
+struct sd_analysis_list {
+	struct sd_analysis_entry *items;
+	size_t size;
+	size_t asize;
+};
+
+/* sd_analysis - what a document holds, as found by sd_analyze */
+struct sd_analysis {
+	struct sd_analysis_list headers;
+	struct sd_analysis_list links;
+	struct sd_analysis_list images;
+	size_t words;		/* words of the text, code blocks left out */
+	struct buf *data;
+
+	/* analysis state */
+	const uint8_t *document;
+	size_t doc_size;
+	size_t cursor;		/* where the last element was found */
+	size_t search_left;	/* bytes the searches may still read */
+	size_t header;		/* header and link being read, or SD_ANALYSIS_NONE */
+	size_t link;
+	size_t link_start;	/* where the text of the link starts in text */
+	size_t in_word;		/* length of the word being read */
+	struct buf *text;	/* text of the header and link being read */
+	struct buf *ob;		/* output of the parser, left unused */
+};
+
+/**********************
+ * EXPORTED FUNCTIONS *
+ **********************/
+
+extern struct sd_analysis *
+sd_analysis_new(void);
+
+extern void
+sd_analysis_free(struct sd_analysis *analysis);
+
+/* sd_analysis_renderer - callbacks that fill the analysis given as the */
+/* opaque pointer of sd_markdown_new; they only read the parsed text and */
+/* render nothing, and leave code blocks and HTML blocks unparsed */
+extern void
+sd_analysis_renderer(struct sd_callbacks *callbacks);
+
+/* sd_analyze - fills the analysis with the content of the document, */
+/* parsed by md which must use the callbacks of sd_analysis_renderer */
+/* over the same analysis; the previous content is dropped */
+extern void
+sd_analyze(struct sd_analysis *analysis, struct sd_markdown *md,
+	const uint8_t *document, size_t doc_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/* vim: set filetype=c: */
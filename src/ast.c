@@ -0,0 +1,1179 @@
+/* ast.c - flat syntax tree of a parsed document */
+
+/*
+ * Copyright (c) 2011, Vicent Marti
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "ast.h"
+#include "stack.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+#define AST_DATA_UNIT 1024
+
+/* saved trees: a header, the nodes, then the data */
+#define AST_FILE_VERSION 1
+
+struct ast_file {
+	char magic[4];			/* "SDAT" */
+	uint32_t version;		/* AST_FILE_VERSION, byte swapped on the */
+							/* other kind of machine */
+	uint32_t node_size;
+	uint32_t node_count;
+	uint32_t data_size;
+};
+
+/* walk_mode - how an element is handed over to the callbacks */
+enum walk_mode {
+	WALK_SKIP,		/* left out */
+	WALK_DISCARD,	/* rendered into a buffer that is dropped */
+	WALK_EVENTS,	/* content rendered between enter and leave */
+	WALK_BUFFERED,	/* content rendered into a buffer for the callback */
+	WALK_INLINE,	/* content rendered in place of the element */
+};
+
+struct walk_frame {
+	size_t node;
+	size_t child;		/* next child to render */
+	int mode;
+	int bufs;			/* work buffers taken by the frame */
+	struct buf *ob;		/* output of the element */
+	struct buf *out;	/* output of its children */
+	struct buf *head;	/* header rows of a buffered table */
+	size_t start;		/* where the children start in out */
+	size_t offset;		/* size of ob before enter */
+	size_t parent_offset;
+};
+
+struct ast_walk {
+	const struct sd_ast *ast;
+	const struct sd_callbacks *cb;
+	void *opaque;
+	int events;
+	struct walk_frame *frames;
+	size_t size;
+	size_t asize;
+	struct stack work_bufs;
+};
+
+/*********************
+ * BUILDING THE TREE *
+ *********************/
+
+/* ast_reset • empties the tree down to the document node */
+static void
+ast_reset(struct sd_ast *ast)
+{
+	struct sd_ast_node *root = ast->nodes;
+
+	root->type = SD_AST_DOCUMENT;
+	root->flags = 0;
+	root->parent = root->next = SD_AST_NONE;
+	root->first_child = root->last_child = SD_AST_NONE;
+	root->text.offset = root->close.offset = SD_AST_NONE;
+	root->link.offset = root->title.offset = SD_AST_NONE;
+	root->text.size = root->close.size = 0;
+	root->link.size = root->title.size = 0;
+
+	ast->size = 1;
+	ast->data->size = 0;
+	ast->current = 0;
+	ast->text_start = 0;
+	ast->dropped = 0;
+}
+
+/* ast_push • appends a node to the children of the current one */
+/*	returns its index, SD_AST_NONE when the arena cannot grow or the */
+/*	current block is being left out */
+static size_t
+ast_push(struct sd_ast *ast, int type, int flags)
+{
+	struct sd_ast_node *node, *parent;
+	size_t n = ast->size;
+
+	if (ast->dropped || n >= SD_AST_NONE)
+		return SD_AST_NONE;
+
+	if (n >= ast->asize) {
+		struct sd_ast_node *nodes;
+		size_t asize = ast->asize * 2;
+
+		nodes = realloc(ast->nodes, asize * sizeof(struct sd_ast_node));
+		if (!nodes)
+			return SD_AST_NONE;
+
+		ast->nodes = nodes;
+		ast->asize = asize;
+	}
+
+	node = &ast->nodes[n];
+	node->type = type;
+	node->flags = flags;
+	node->parent = ast->current;
+	node->first_child = node->last_child = node->next = SD_AST_NONE;
+	node->text.offset = node->close.offset = SD_AST_NONE;
+	node->link.offset = node->title.offset = SD_AST_NONE;
+	node->text.size = node->close.size = 0;
+	node->link.size = node->title.size = 0;
+
+	parent = &ast->nodes[ast->current];
+	if (parent->last_child == SD_AST_NONE)
+		parent->first_child = n;
+	else
+		ast->nodes[parent->last_child].next = n;
+	parent->last_child = n;
+
+	ast->size++;
+	return n;
+}
+
+/* ast_store • copies text given by the parser into the tree */
+static void
+ast_store(struct sd_ast *ast, struct sd_ast_text *text, const uint8_t *data, size_t size)
+{
+	if (size >= SD_AST_NONE - ast->data->size)
+		return;
+
+	text->offset = ast->data->size;
+	text->size = size;
+	if (size)
+		bufput(ast->data, data, size);
+}
+
+/* ast_storebuf • copies a buffer given by the parser, if any */
+static void
+ast_storebuf(struct sd_ast *ast, struct sd_ast_text *text, const struct buf *buf)
+{
+	if (buf)
+		ast_store(ast, text, buf->data, buf->size);
+}
+
+/* ast_flush • turns the text rendered since the last node into a node */
+/*	the text stays in ob until then, so the parser can still trim it */
+/*	for line breaks and take back the start of autolinks; ob is emptied */
+/*	whenever no span is open, so it never holds more than a block */
+static void
+ast_flush(struct sd_ast *ast, struct buf *ob)
+{
+	int type = ast->nodes[ast->current].type;
+	size_t n = ast->nodes[ast->current].last_child, taken;
+
+	/* text taken back from a node that was already flushed */
+	if (ob->size < ast->text_start && n != SD_AST_NONE &&
+		ast->nodes[n].type == SD_AST_TEXT) {
+		taken = ast->text_start - ob->size;
+		ast->nodes[n].text.size -= (taken < ast->nodes[n].text.size) ?
+			taken : ast->nodes[n].text.size;
+	}
+
+	if (ob->size > ast->text_start) {
+		n = ast_push(ast, SD_AST_TEXT, 0);
+		if (n != SD_AST_NONE)
+			ast_store(ast, &ast->nodes[n].text,
+				ob->data + ast->text_start, ob->size - ast->text_start);
+	}
+
+	if (type < SD_NODE_EMPHASIS || type == SD_AST_DOCUMENT)
+		ob->size = 0;
+
+	ast->text_start = ob->size;
+}
+
+/* ast_leaf • adds an element without content after the pending text */
+static struct sd_ast_node *
+ast_leaf(struct sd_ast *ast, struct buf *ob, int type, int flags, const struct buf *text)
+{
+	size_t n;
+
+	ast_flush(ast, ob);
+
+	n = ast_push(ast, type, flags);
+	if (n == SD_AST_NONE)
+		return NULL;
+
+	ast_storebuf(ast, &ast->nodes[n].text, text);
+	return &ast->nodes[n];
+}
+
+static int
+ast_enter(struct buf *ob, const struct sd_node *node, void *opaque)
+{
+	struct sd_ast *ast = opaque;
+	size_t n;
+
+	ast_flush(ast, ob);
+
+	n = ast_push(ast, node->type, node->flags);
+	if (n == SD_AST_NONE) {
+		/* out of memory: spans are turned down, blocks are left out */
+		/* along with everything inside them */
+		if (node->type >= SD_NODE_EMPHASIS)
+			return 0;
+		ast->dropped++;
+		return 1;
+	}
+
+	ast_storebuf(ast, &ast->nodes[n].link, node->link);
+	ast_storebuf(ast, &ast->nodes[n].title, node->title);
+
+	/* the marks around the content of spans, to print them verbatim */
+	if (node->source) {
+		ast_store(ast, &ast->nodes[n].text, node->source, node->content_begin);
+		ast_store(ast, &ast->nodes[n].close, node->source + node->content_end,
+			node->source_size - node->content_end);
+	}
+
+	ast->current = n;
+	return 1;
+}
+
+static int
+ast_leave(struct buf *ob, const struct sd_node *node, void *opaque)
+{
+	struct sd_ast *ast = opaque;
+
+	ast_flush(ast, ob);
+
+	if (ast->dropped) {
+		ast->dropped--;
+		return 1;
+	}
+
+	/* list flags are only complete once the last item is parsed */
+	ast->nodes[ast->current].flags = node->flags;
+	ast->current = ast->nodes[ast->current].parent;
+	return 1;
+}
+
+/* ast_block • enables a block, its content comes between enter and leave */
+static void
+ast_block(struct buf *ob, const struct buf *text, void *opaque)
+{
+}
+
+static void
+ast_block_flags(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+}
+
+static void
+ast_table(struct buf *ob, const struct buf *header, const struct buf *body, void *opaque)
+{
+}
+
+/* ast_span • enables a span, its content comes between enter and leave */
+static int
+ast_span(struct buf *ob, const struct buf *text, void *opaque)
+{
+	return 1;
+}
+
+static void
+ast_blockcode(struct buf *ob, const struct buf *text, const struct buf *lang, void *opaque)
+{
+	struct sd_ast *ast = opaque;
+	struct sd_ast_node *node = ast_leaf(ast, ob, SD_AST_BLOCKCODE, 0, text);
+
+	if (node)
+		ast_storebuf(ast, &node->link, lang);
+}
+
+static void
+ast_blockhtml(struct buf *ob, const struct buf *text, void *opaque)
+{
+	ast_leaf(opaque, ob, SD_AST_BLOCKHTML, 0, text);
+}
+
+static void
+ast_hrule(struct buf *ob, void *opaque)
+{
+	ast_leaf(opaque, ob, SD_AST_HRULE, 0, NULL);
+}
+
+static int
+ast_autolink(struct buf *ob, const struct buf *link, enum mkd_autolink type, void *opaque)
+{
+	ast_leaf(opaque, ob, SD_AST_AUTOLINK, type, link);
+	return 1;
+}
+
+static int
+ast_codespan(struct buf *ob, const struct buf *text, void *opaque)
+{
+	ast_leaf(opaque, ob, SD_AST_CODESPAN, 0, text);
+	return 1;
+}
+
+static int
+ast_image(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *alt, void *opaque)
+{
+	struct sd_ast *ast = opaque;
+	struct sd_ast_node *node = ast_leaf(ast, ob, SD_AST_IMAGE, 0, alt);
+
+	if (node) {
+		ast_storebuf(ast, &node->link, link);
+		ast_storebuf(ast, &node->title, title);
+	}
+	return 1;
+}
+
+static int
+ast_linebreak(struct buf *ob, void *opaque)
+{
+	ast_leaf(opaque, ob, SD_AST_LINEBREAK, 0, NULL);
+	return 1;
+}
+
+/* ast_link • a link without parsed content: empty, or a "www." autolink */
+static int
+ast_link(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *content, void *opaque)
+{
+	struct sd_ast *ast = opaque;
+	struct sd_ast_node *node = ast_leaf(ast, ob, SD_NODE_LINK, 0, content);
+
+	if (node) {
+		ast_storebuf(ast, &node->link, link);
+		ast_storebuf(ast, &node->title, title);
+	}
+	return 1;
+}
+
+static int
+ast_raw_html(struct buf *ob, const struct buf *tag, void *opaque)
+{
+	ast_leaf(opaque, ob, SD_AST_RAW_HTML, 0, tag);
+	return 1;
+}
+
+static void
+ast_entity(struct buf *ob, const struct buf *entity, void *opaque)
+{
+	ast_leaf(opaque, ob, SD_AST_ENTITY, 0, entity);
+}
+
+/* ast_normal_text • text is left in ob until the next node, see ast_flush */
+static void
+ast_normal_text(struct buf *ob, const struct buf *text, void *opaque)
+{
+	bufput(ob, text->data, text->size);
+}
+
+static void
+ast_doc_header(struct buf *ob, void *opaque)
+{
+	struct sd_ast *ast = opaque;
+
+	ast_reset(ast);
+	ast->text_start = ob->size;
+}
+
+static void
+ast_doc_footer(struct buf *ob, void *opaque)
+{
+	ast_flush(opaque, ob);
+}
+
+/**********************
+ * RENDERING THE TREE *
+ **********************/
+
+/* ast_text • points view at text of the tree, NULL when there is none */
+static const struct buf *
+ast_text(struct buf *view, const struct sd_ast *ast, const struct sd_ast_text *text)
+{
+	if (text->offset == SD_AST_NONE)
+		return NULL;
+
+	view->data = ast->data->data + text->offset;
+	view->size = text->size;
+	view->asize = 0;
+	view->unit = ast->data->unit;
+	return view;
+}
+
+static struct buf *
+walk_newbuf(struct ast_walk *walk)
+{
+	struct stack *pool = &walk->work_bufs;
+	struct buf *work;
+
+	if (pool->size < pool->asize && pool->item[pool->size] != NULL) {
+		work = pool->item[pool->size++];
+		work->size = 0;
+	} else {
+		work = bufnew(256);
+		stack_push(pool, work);
+	}
+
+	return work;
+}
+
+/* ast_isleaf • tells elements without children from the others, the */
+/*	document aside */
+static inline int
+ast_isleaf(const struct sd_ast_node *node)
+{
+	return node->type >= SD_AST_DOCUMENT ||
+		(node->type == SD_NODE_LINK && node->close.offset == SD_AST_NONE);
+}
+
+/* walk_text • renders text the way the parser hands it over */
+static void
+walk_text(struct ast_walk *walk, struct buf *ob, const struct buf *text)
+{
+	if (!text)
+		return;
+
+	if (walk->cb->normal_text)
+		walk->cb->normal_text(ob, text, walk->opaque);
+	else
+		bufput(ob, text->data, text->size);
+}
+
+/* walk_mark • prints the opening or closing mark of a span verbatim */
+static void
+walk_mark(struct ast_walk *walk, struct buf *ob, const struct sd_ast_text *mark)
+{
+	struct buf view;
+	walk_text(walk, ob, ast_text(&view, walk->ast, mark));
+}
+
+/* walk_leaf • renders an element without children */
+static void
+walk_leaf(struct ast_walk *walk, struct buf *ob, const struct sd_ast_node *node)
+{
+	const struct sd_callbacks *cb = walk->cb;
+	void *opaque = walk->opaque;
+	struct buf text_view, link_view, title_view;
+	const struct buf *text, *link, *title;
+	struct buf *content;
+	int r = 0;
+
+	text = ast_text(&text_view, walk->ast, &node->text);
+	link = ast_text(&link_view, walk->ast, &node->link);
+	title = ast_text(&title_view, walk->ast, &node->title);
+
+	switch (node->type) {
+	case SD_AST_BLOCKCODE:
+		if (cb->blockcode)
+			cb->blockcode(ob, text, link, opaque);
+		return;
+
+	case SD_AST_BLOCKHTML:
+		if (cb->blockhtml)
+			cb->blockhtml(ob, text, opaque);
+		return;
+
+	case SD_AST_HRULE:
+		if (cb->hrule)
+			cb->hrule(ob, opaque);
+		return;
+
+	case SD_AST_AUTOLINK:
+		r = cb->autolink && cb->autolink(ob, text, node->flags, opaque);
+		break;
+
+	case SD_AST_CODESPAN:
+		r = cb->codespan && cb->codespan(ob, text, opaque);
+		break;
+
+	case SD_AST_IMAGE:
+		r = cb->image && cb->image(ob, link, title, text, opaque);
+		break;
+
+	case SD_AST_LINEBREAK:
+		text_view.data = (uint8_t *)"\n";
+		text_view.size = 1;
+		text = &text_view;
+		r = cb->linebreak && cb->linebreak(ob, opaque);
+		break;
+
+	case SD_AST_RAW_HTML:
+		r = cb->raw_html_tag && cb->raw_html_tag(ob, text, opaque);
+		break;
+
+	case SD_AST_ENTITY:
+		if (cb->entity)
+			cb->entity(ob, text, opaque);
+		else
+			bufput(ob, text->data, text->size);
+		return;
+
+	case SD_NODE_LINK:
+		if (!cb->link)
+			break;
+
+		/* the content of "www." autolinks goes through normal_text */
+		if (text && cb->normal_text) {
+			content = walk_newbuf(walk);
+			cb->normal_text(content, text, opaque);
+			r = cb->link(ob, link, title, content, opaque);
+			walk->work_bufs.size--;
+		} else
+			r = cb->link(ob, link, title, text, opaque);
+		break;
+	}
+
+	if (!r)
+		walk_text(walk, ob, text);
+}
+
+/* walk_mode • picks how an element is rendered inside its parent frame */
+static int
+walk_mode(struct ast_walk *walk, const struct walk_frame *parent, int type)
+{
+	const struct sd_callbacks *cb = walk->cb;
+	int has_callback = 0;
+
+	switch (type) {
+	case SD_NODE_BLOCKQUOTE: has_callback = (cb->blockquote != NULL); break;
+	case SD_NODE_HEADER: has_callback = (cb->header != NULL); break;
+	case SD_NODE_LIST: has_callback = (cb->list != NULL); break;
+	case SD_NODE_LISTITEM: has_callback = (cb->listitem != NULL); break;
+	case SD_NODE_PARAGRAPH: has_callback = (cb->paragraph != NULL); break;
+
+	case SD_NODE_TABLE:
+		if (walk->events && cb->table)
+			return WALK_EVENTS;
+		return (cb->table || cb->table_begin) ? WALK_BUFFERED : WALK_DISCARD;
+
+	case SD_NODE_TABLE_HEAD:
+	case SD_NODE_TABLE_BODY:
+		return parent->mode == WALK_EVENTS ? WALK_EVENTS : WALK_INLINE;
+
+	case SD_NODE_TABLE_ROW:
+		if (!cb->table_row || !cb->table_cell)
+			return WALK_SKIP;
+		/* fall through */
+	case SD_NODE_TABLE_CELL:
+		return parent->mode == WALK_EVENTS ? WALK_EVENTS : WALK_BUFFERED;
+
+	case SD_NODE_EMPHASIS: has_callback = (cb->emphasis != NULL); break;
+	case SD_NODE_DOUBLE_EMPHASIS: has_callback = (cb->double_emphasis != NULL); break;
+	case SD_NODE_TRIPLE_EMPHASIS: has_callback = (cb->triple_emphasis != NULL); break;
+	case SD_NODE_STRIKETHROUGH: has_callback = (cb->strikethrough != NULL); break;
+	case SD_NODE_SUPERSCRIPT: has_callback = (cb->superscript != NULL); break;
+	case SD_NODE_LINK: has_callback = (cb->link != NULL); break;
+	}
+
+	/* like the parser, blocks without a callback are still rendered, */
+	/* for whatever state the callbacks of their content keep */
+	if (!has_callback)
+		return type < SD_NODE_EMPHASIS ? WALK_DISCARD : WALK_INLINE;
+
+	return walk->events ? WALK_EVENTS : WALK_BUFFERED;
+}
+
+/* walk_node • fills the sd_node of an element for enter and leave */
+static void
+walk_node(struct sd_node *event, struct buf *link_view, struct buf *title_view,
+	const struct sd_ast *ast, const struct sd_ast_node *node)
+{
+	event->type = node->type;
+	event->flags = node->flags;
+	event->link = ast_text(link_view, ast, &node->link);
+	event->title = ast_text(title_view, ast, &node->title);
+	event->parent_offset = 0;
+	event->offset = 0;
+	event->content_offset = 0;
+}
+
+/* walk_open • starts rendering an element with children */
+static void
+walk_open(struct ast_walk *walk, size_t n)
+{
+	const struct sd_ast_node *node = &walk->ast->nodes[n];
+	struct walk_frame *parent = &walk->frames[walk->size - 1], *frame;
+	struct buf link_view, title_view;
+	struct sd_node event;
+	int mode;
+
+	mode = walk_mode(walk, parent, node->type);
+	if (mode == WALK_SKIP)
+		return;
+
+	if (walk->size >= walk->asize) {
+		struct walk_frame *frames;
+		size_t asize = walk->asize * 2;
+
+		frames = realloc(walk->frames, asize * sizeof(struct walk_frame));
+		if (!frames)
+			return;
+
+		walk->frames = frames;
+		walk->asize = asize;
+		parent = &walk->frames[walk->size - 1];
+	}
+
+	frame = &walk->frames[walk->size++];
+	frame->node = n;
+	frame->child = node->first_child;
+	frame->mode = mode;
+	frame->bufs = 0;
+	frame->ob = parent->out;
+	frame->out = parent->out;
+	frame->head = NULL;
+	frame->start = parent->start;
+	frame->offset = 0;
+	frame->parent_offset = parent->start;
+
+	switch (mode) {
+	case WALK_EVENTS:
+		walk_node(&event, &link_view, &title_view, walk->ast, node);
+		event.parent_offset = frame->parent_offset;
+		event.offset = frame->offset = frame->ob->size;
+
+		if (!walk->cb->enter(frame->ob, &event, walk->opaque) &&
+			node->type >= SD_NODE_EMPHASIS) {
+			frame->ob->size = frame->offset;
+			frame->mode = WALK_INLINE;
+			walk_mark(walk, frame->out, &node->text);
+		} else
+			frame->start = frame->ob->size;
+		break;
+
+	case WALK_DISCARD:
+	case WALK_BUFFERED:
+		frame->out = walk_newbuf(walk);
+		frame->bufs = 1;
+		frame->start = 0;
+
+		if (node->type == SD_NODE_TABLE) {
+			frame->head = frame->out;
+			if (mode == WALK_BUFFERED && walk->cb->table_begin)
+				frame->out = frame->ob;
+			else {
+				frame->out = walk_newbuf(walk);
+				frame->bufs = 2;
+			}
+		}
+		break;
+
+	case WALK_INLINE:
+		if (node->type == SD_NODE_TABLE_HEAD)
+			frame->out = parent->head;
+		else if (node->type >= SD_NODE_EMPHASIS)
+			walk_mark(walk, frame->out, &node->text);
+		break;
+	}
+}
+
+/* walk_close • renders an element once its children are, returning 0 */
+/*	when it has to be rendered again in place of the element */
+static int
+walk_close(struct ast_walk *walk, struct walk_frame *frame)
+{
+	const struct sd_callbacks *cb = walk->cb;
+	const struct sd_ast_node *node = &walk->ast->nodes[frame->node];
+	struct buf link_view, title_view;
+	struct sd_node event;
+	int r = 1;
+
+	switch (frame->mode) {
+	case WALK_EVENTS:
+		walk_node(&event, &link_view, &title_view, walk->ast, node);
+		event.parent_offset = frame->parent_offset;
+		event.offset = frame->offset;
+		event.content_offset = frame->start;
+
+		if (!cb->leave(frame->ob, &event, walk->opaque) &&
+			node->type >= SD_NODE_EMPHASIS) {
+			frame->ob->size = frame->offset;
+
+			/* superscripts are consumed even when left out */
+			if (node->type == SD_NODE_SUPERSCRIPT)
+				break;
+
+			frame->mode = WALK_INLINE;
+			frame->child = node->first_child;
+			frame->start = frame->parent_offset;
+			walk_mark(walk, frame->out, &node->text);
+			return 0;
+		}
+		break;
+
+	case WALK_BUFFERED:
+		switch (node->type) {
+		case SD_NODE_BLOCKQUOTE:
+			cb->blockquote(frame->ob, frame->out, walk->opaque);
+			break;
+
+		case SD_NODE_HEADER:
+			cb->header(frame->ob, frame->out, node->flags, walk->opaque);
+			break;
+
+		case SD_NODE_LIST:
+			cb->list(frame->ob, frame->out, node->flags, walk->opaque);
+			break;
+
+		case SD_NODE_LISTITEM:
+			cb->listitem(frame->ob, frame->out, node->flags, walk->opaque);
+			break;
+
+		case SD_NODE_PARAGRAPH:
+			cb->paragraph(frame->ob, frame->out, walk->opaque);
+			break;
+
+		case SD_NODE_TABLE:
+			if (!cb->table_begin)
+				cb->table(frame->ob, frame->head, frame->out, walk->opaque);
+			else if (cb->table_end)
+				cb->table_end(frame->ob, walk->opaque);
+			break;
+
+		case SD_NODE_TABLE_ROW:
+			cb->table_row(frame->ob, frame->out, walk->opaque);
+			break;
+
+		case SD_NODE_TABLE_CELL:
+			cb->table_cell(frame->ob, frame->out, node->flags, walk->opaque);
+			break;
+
+		case SD_NODE_EMPHASIS:
+			r = cb->emphasis(frame->ob, frame->out, walk->opaque);
+			break;
+
+		case SD_NODE_DOUBLE_EMPHASIS:
+			r = cb->double_emphasis(frame->ob, frame->out, walk->opaque);
+			break;
+
+		case SD_NODE_TRIPLE_EMPHASIS:
+			r = cb->triple_emphasis(frame->ob, frame->out, walk->opaque);
+			break;
+
+		case SD_NODE_STRIKETHROUGH:
+			r = cb->strikethrough(frame->ob, frame->out, walk->opaque);
+			break;
+
+		case SD_NODE_SUPERSCRIPT:
+			cb->superscript(frame->ob, frame->out, walk->opaque);
+			break;
+
+		case SD_NODE_LINK:
+			r = cb->link(frame->ob, ast_text(&link_view, walk->ast, &node->link),
+				ast_text(&title_view, walk->ast, &node->title), frame->out, walk->opaque);
+			break;
+		}
+
+		if (!r) {
+			walk_mark(walk, frame->ob, &node->text);
+			bufput(frame->ob, frame->out->data, frame->out->size);
+			walk_mark(walk, frame->ob, &node->close);
+		}
+		break;
+
+	case WALK_INLINE:
+		/* streamed tables start once their header rows are rendered */
+		if (node->type == SD_NODE_TABLE_HEAD && cb->table_begin &&
+			walk->frames[walk->size - 2].mode == WALK_BUFFERED)
+			cb->table_begin(frame->ob, frame->out, walk->opaque);
+		else if (node->type >= SD_NODE_EMPHASIS)
+			walk_mark(walk, frame->out, &node->close);
+		break;
+	}
+
+	walk->work_bufs.size -= frame->bufs;
+	return 1;
+}
+
+/**********************
+ * ITERATING THE TREE *
+ **********************/
+
+enum iter_state {
+	ITER_START,
+	ITER_ENTERED,	/* the children of the node are next */
+	ITER_FINISHED,	/* the siblings of the node are next */
+	ITER_END,
+};
+
+/* iter_slice • points a slice of an event at text of the tree */
+static void
+iter_slice(const uint8_t **data, size_t *size,
+	const struct sd_ast *ast, const struct sd_ast_text *text)
+{
+	if (text->offset == SD_AST_NONE) {
+		*data = NULL;
+		*size = 0;
+	} else {
+		*data = ast->data->data + text->offset;
+		*size = text->size;
+	}
+}
+
+/* iter_event • fills an event for a node of the tree */
+static int
+iter_event(struct sd_event *ev, const struct sd_ast *ast, size_t n, int event)
+{
+	const struct sd_ast_node *node = &ast->nodes[n];
+
+	ev->event = event;
+	ev->type = node->type;
+	ev->flags = node->flags;
+	ev->node = n;
+	iter_slice(&ev->text, &ev->text_size, ast, &node->text);
+	iter_slice(&ev->close, &ev->close_size, ast, &node->close);
+	iter_slice(&ev->link, &ev->link_size, ast, &node->link);
+	iter_slice(&ev->title, &ev->title_size, ast, &node->title);
+	return 1;
+}
+
+/**********************
+ * EXPORTED FUNCTIONS *
+ **********************/
+
+struct sd_ast *
+sd_ast_new(void)
+{
+	struct sd_ast *ast;
+
+	ast = malloc(sizeof(struct sd_ast));
+	if (!ast)
+		return NULL;
+
+	ast->asize = 64;
+	ast->nodes = malloc(ast->asize * sizeof(struct sd_ast_node));
+	ast->data = bufnew(AST_DATA_UNIT);
+
+	if (!ast->nodes || !ast->data || bufgrow(ast->data, AST_DATA_UNIT) < 0) {
+		sd_ast_free(ast);
+		return NULL;
+	}
+
+	ast_reset(ast);
+	return ast;
+}
+
+void
+sd_ast_free(struct sd_ast *ast)
+{
+	if (!ast)
+		return;
+
+	/* loaded trees only own their structures */
+	if (ast->asize == 0) {
+		free(ast->data);
+		free(ast);
+		return;
+	}
+
+	free(ast->nodes);
+	bufrelease(ast->data);
+	free(ast);
+}
+
+void
+sd_ast_save(struct buf *ob, const struct sd_ast *ast)
+{
+	struct ast_file file;
+
+	memcpy(file.magic, "SDAT", 4);
+	file.version = AST_FILE_VERSION;
+	file.node_size = sizeof(struct sd_ast_node);
+	file.node_count = ast->size;
+	file.data_size = ast->data->size;
+
+	bufgrow(ob, ob->size + sizeof(file) +
+		ast->size * sizeof(struct sd_ast_node) + ast->data->size);
+
+	bufput(ob, &file, sizeof(file));
+	bufput(ob, ast->nodes, ast->size * sizeof(struct sd_ast_node));
+	bufput(ob, ast->data->data, ast->data->size);
+}
+
+/* ast_valid • checks the links and text of a loaded tree, so that walking */
+/*	it stays within its data and always moves forward */
+static int
+ast_valid(const struct sd_ast_node *nodes, size_t count, size_t data_size)
+{
+	const struct sd_ast_node *node;
+	const struct sd_ast_text *text;
+	size_t i, j;
+
+	if (nodes[0].type != SD_AST_DOCUMENT || nodes[0].next != SD_AST_NONE)
+		return 0;
+
+	for (i = 0; i < count; ++i) {
+		node = &nodes[i];
+
+		if (node->type < SD_NODE_BLOCKQUOTE || node->type > SD_AST_TEXT)
+			return 0;
+
+		if ((i && (node->parent >= i || node->type == SD_AST_DOCUMENT)) ||
+			(node->first_child != SD_AST_NONE &&
+				(node->first_child <= i || node->first_child >= count ||
+				nodes[node->first_child].parent != i)) ||
+			(node->next != SD_AST_NONE &&
+				(node->next <= i || node->next >= count ||
+				nodes[node->next].parent != node->parent)))
+			return 0;
+
+		/* table parts are rendered with the help of their table */
+		switch (node->type) {
+		case SD_NODE_TABLE_HEAD:
+		case SD_NODE_TABLE_BODY:
+			if (nodes[node->parent].type != SD_NODE_TABLE)
+				return 0;
+			break;
+
+		case SD_NODE_TABLE_ROW:
+			if (nodes[node->parent].type != SD_NODE_TABLE_HEAD &&
+				nodes[node->parent].type != SD_NODE_TABLE_BODY)
+				return 0;
+			break;
+
+		case SD_NODE_TABLE_CELL:
+			if (nodes[node->parent].type != SD_NODE_TABLE_ROW)
+				return 0;
+			break;
+		}
+
+		/* the parser always gives these some text */
+		if (node->text.offset == SD_AST_NONE &&
+			(node->type == SD_AST_BLOCKCODE || node->type == SD_AST_BLOCKHTML ||
+			node->type == SD_AST_AUTOLINK || node->type == SD_AST_RAW_HTML ||
+			node->type == SD_AST_ENTITY || node->type == SD_AST_TEXT))
+			return 0;
+
+		for (j = 0; j < 4; ++j) {
+			text = (j == 0) ? &node->text : (j == 1) ? &node->close :
+				(j == 2) ? &node->link : &node->title;
+
+			if (text->offset != SD_AST_NONE &&
+				(text->offset > data_size || text->size > data_size - text->offset))
+				return 0;
+		}
+	}
+
+	return 1;
+}
+
+struct sd_ast *
+sd_ast_load(const uint8_t *data, size_t size)
+{
+	struct ast_file file;
+	struct sd_ast *ast;
+	size_t nodes_size;
+
+	if (size < sizeof(file) || ((uintptr_t)data & 3) != 0)
+		return NULL;
+
+	memcpy(&file, data, sizeof(file));
+
+	if (memcmp(file.magic, "SDAT", 4) != 0 ||
+		file.version != AST_FILE_VERSION ||
+		file.node_size != sizeof(struct sd_ast_node) ||
+		file.node_count == 0 || file.node_count >= SD_AST_NONE)
+		return NULL;
+
+	nodes_size = (size_t)file.node_count * sizeof(struct sd_ast_node);
+	if (nodes_size > size - sizeof(file) ||
+		file.data_size > size - sizeof(file) - nodes_size)
+		return NULL;
+
+	if (!ast_valid((const struct sd_ast_node *)(data + sizeof(file)),
+			file.node_count, file.data_size))
+		return NULL;
+
+	ast = malloc(sizeof(struct sd_ast));
+	if (!ast)
+		return NULL;
+
+	ast->data = malloc(sizeof(struct buf));
+	if (!ast->data) {
+		free(ast);
+		return NULL;
+	}
+
+	/* a volatile buffer and no room for nodes: nothing to free or grow */
+	ast->data->data = (uint8_t *)data + sizeof(file) + nodes_size;
+	ast->data->size = file.data_size;
+	ast->data->asize = 0;
+	ast->data->unit = AST_DATA_UNIT;
+
+	ast->nodes = (struct sd_ast_node *)(data + sizeof(file));
+	ast->size = file.node_count;
+	ast->asize = 0;
+	ast->current = 0;
+	ast->text_start = 0;
+	ast->dropped = 0;
+
+	return ast;
+}
+
+void
+sd_ast_renderer(struct sd_callbacks *callbacks)
+{
+	static const struct sd_callbacks cb_default = {
+		ast_blockcode,
+		ast_block,
+		ast_blockhtml,
+		ast_block_flags,
+		ast_hrule,
+		ast_block_flags,
+		ast_block_flags,
+		ast_block,
+		ast_table,
+		ast_block,
+		ast_block_flags,
+
+		ast_autolink,
+		ast_codespan,
+		ast_span,
+		ast_span,
+		ast_image,
+		ast_linebreak,
+		ast_link,
+		ast_raw_html,
+		ast_span,
+		ast_span,
+		ast_span,
+
+		ast_entity,
+		ast_normal_text,
+
+		ast_doc_header,
+		ast_doc_footer,
+
+		NULL,
+		NULL,
+
+		ast_enter,
+		ast_leave,
+	};
+
+	memcpy(callbacks, &cb_default, sizeof(struct sd_callbacks));
+}
+
+void
+sd_ast_render(struct buf *ob, const struct sd_ast *ast,
+	const struct sd_callbacks *callbacks, void *opaque)
+{
+	struct ast_walk walk;
+	struct walk_frame *frame;
+	size_t i, n;
+
+	walk.ast = ast;
+	walk.cb = callbacks;
+	walk.opaque = opaque;
+	walk.events = (callbacks->enter && callbacks->leave);
+	walk.asize = 16;
+	walk.frames = malloc(walk.asize * sizeof(struct walk_frame));
+	stack_init(&walk.work_bufs, 4);
+
+	if (!walk.frames)
+		return;
+
+	bufgrow(ob, ob->size + ast->data->size + (ast->data->size >> 1));
+
+	if (callbacks->doc_header)
+		callbacks->doc_header(ob, opaque);
+
+	/* the document renders its blocks straight into ob */
+	frame = &walk.frames[0];
+	memset(frame, 0x0, sizeof(struct walk_frame));
+	frame->node = 0;
+	frame->child = ast->nodes[0].first_child;
+	frame->mode = WALK_INLINE;
+	frame->ob = frame->out = ob;
+	walk.size = 1;
+
+	while (walk.size) {
+		frame = &walk.frames[walk.size - 1];
+		n = frame->child;
+
+		if (n == SD_AST_NONE) {
+			if (walk_close(&walk, frame))
+				walk.size--;
+			continue;
+		}
+
+		frame->child = ast->nodes[n].next;
+
+		if (ast_isleaf(&ast->nodes[n]))
+			walk_leaf(&walk, frame->out, &ast->nodes[n]);
+		else
+			walk_open(&walk, n);
+	}
+
+	if (callbacks->doc_footer)
+		callbacks->doc_footer(ob, opaque);
+
+	for (i = 0; i < walk.work_bufs.asize; ++i)
+		bufrelease(walk.work_bufs.item[i]);
+
+	stack_free(&walk.work_bufs);
+	free(walk.frames);
+}
+
+void
+sd_ast_iter_init(struct sd_ast_iter *iter, const struct sd_ast *ast)
+{
+	iter->ast = ast;
+	iter->node = 0;
+	iter->state = ITER_START;
+}
+
+int
+sd_next_event(struct sd_ast_iter *iter, struct sd_event *ev)
+{
+	const struct sd_ast_node *nodes = iter->ast->nodes;
+	size_t n = iter->node;
+
+	switch (iter->state) {
+	case ITER_START:
+		iter->state = ITER_ENTERED;
+		return iter_event(ev, iter->ast, 0, SD_EVENT_ENTER);
+
+	case ITER_ENTERED:
+		if (nodes[n].first_child != SD_AST_NONE) {
+			n = nodes[n].first_child;
+			break;
+		}
+
+		iter->state = ITER_FINISHED;
+		return iter_event(ev, iter->ast, n, SD_EVENT_LEAVE);
+
+	case ITER_FINISHED:
+		if (n == 0) {
+			iter->state = ITER_END;
+			break;
+		}
+
+		if (nodes[n].next != SD_AST_NONE) {
+			n = nodes[n].next;
+			break;
+		}
+
+		iter->node = nodes[n].parent;
+		return iter_event(ev, iter->ast, iter->node, SD_EVENT_LEAVE);
+	}
+
+	if (iter->state == ITER_END) {
+		memset(ev, 0x0, sizeof(struct sd_event));
+		return 0;
+	}
+
+	iter->node = n;
+
+	if (ast_isleaf(&nodes[n])) {
+		iter->state = ITER_FINISHED;
+		return iter_event(ev, iter->ast, n, SD_EVENT_TEXT);
+	}
+
+	iter->state = ITER_ENTERED;
+	return iter_event(ev, iter->ast, n, SD_EVENT_ENTER);
+}
@@ -0,0 +1,175 @@
+/* ast.h - flat syntax tree of a parsed document */
+
+/*
+ * Copyright (c) 2011, Vicent Marti
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef UPSKIRT_AST_H
+#define UPSKIRT_AST_H
+
+#include "markdown.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* no node, or no text */
+#define SD_AST_NONE 0xffffffffu
+
+/* sd_ast_type - the document and the elements without content of their */
+/* own, numbered after sd_node_type which covers the other elements */
+enum sd_ast_type {
+	SD_AST_DOCUMENT = SD_NODE_LINK + 1,
+	SD_AST_BLOCKCODE,
+	SD_AST_BLOCKHTML,
+	SD_AST_HRULE,
+	SD_AST_AUTOLINK,
+	SD_AST_CODESPAN,
+	SD_AST_IMAGE,
+	SD_AST_LINEBREAK,
+	SD_AST_RAW_HTML,
+	SD_AST_ENTITY,
+	SD_AST_TEXT,
+};
+
+/* sd_ast_text - text held in the data of the tree, offset is SD_AST_NONE */
+/* where the parser gave none */
+struct sd_ast_text {
+	uint32_t offset;
+	uint32_t size;
+};
+
+/* sd_ast_node - an element of the tree, linked to the others by index */
+/* nodes only hold fixed-size fields and no pointers, so that a tree can */
+/* be saved and mapped back as is; children and next siblings always */
+/* come after their node */
+struct sd_ast_node {
+	int32_t type;				/* sd_node_type or sd_ast_type */
+	int32_t flags;				/* as in sd_node, or the autolink type */
+	uint32_t parent;
+	uint32_t first_child;
+	uint32_t last_child;
+	uint32_t next;				/* next sibling */
+	struct sd_ast_text text;	/* text, code, HTML, entity, image alt, */
+								/* opening mark of a span */
+	struct sd_ast_text close;	/* closing mark of a span, none for the */
+								/* links given whole by the parser, whose */
+								/* text is their content if they have one */
+	struct sd_ast_text link;	/* unescaped link target, code block language */
+	struct sd_ast_text title;	/* link or image title */
+};
+
+/* sd_ast - a parsed document, its nodes are kept in document order */
+/* and nodes[0] is the document itself */
+struct sd_ast {
+	struct sd_ast_node *nodes;
+	size_t size;
+	size_t asize;		/* 0 for trees loaded with sd_ast_load */
+	struct buf *data;
+
+	/* building state */
+	size_t current;		/* node receiving the next children */
+	size_t text_start;	/* start of the text not yet in a node */
+	size_t dropped;		/* depth of the blocks left out for lack of memory */
+};
+
+/* sd_event_type - what sd_next_event has reached */
+enum sd_event_type {
+	SD_EVENT_DONE = 0,	/* the end of the document */
+	SD_EVENT_ENTER,		/* the start of an element with content */
+	SD_EVENT_LEAVE,		/* the end of an element with content */
+	SD_EVENT_TEXT,		/* an element without content: text, code, image... */
+};
+
+/* sd_event - an event of a pull iteration, its slices point into the */
+/* data of the tree as the texts of sd_ast_node, and are NULL where the */
+/* element has none */
+struct sd_event {
+	int event;					/* sd_event_type */
+	int type;					/* sd_node_type or sd_ast_type */
+	int flags;
+	size_t node;				/* index of the element in the tree */
+	const uint8_t *text;
+	size_t text_size;
+	const uint8_t *close;
+	size_t close_size;
+	const uint8_t *link;
+	size_t link_size;
+	const uint8_t *title;
+	size_t title_size;
+};
+
+/* sd_ast_iter - the position of a pull iteration over a tree */
+struct sd_ast_iter {
+	const struct sd_ast *ast;
+	size_t node;
+	int state;
+};
+
+/**********************
+ * EXPORTED FUNCTIONS *
+ **********************/
+
+extern struct sd_ast *
+sd_ast_new(void);
+
+extern void
+sd_ast_free(struct sd_ast *ast);
+
+/* sd_ast_renderer - callbacks that build the tree given as the opaque */
+/* pointer of sd_markdown_new; the tree replaces the previous one on */
+/* every sd_markdown_render, which only uses ob as scratch space */
+extern void
+sd_ast_renderer(struct sd_callbacks *callbacks);
+
+/* sd_ast_save - appends the tree to ob in a position independent form, */
+/* for sd_ast_load; nodes and data are stored as they are in memory */
+extern void
+sd_ast_save(struct buf *ob, const struct sd_ast *ast);
+
+/* sd_ast_load - a read-only tree over data saved by sd_ast_save, such as */
+/* a mapped file, used in place without copying it; the data must be */
+/* aligned on 4 bytes and outlive the tree. Returns NULL when the data */
+/* is not a valid tree saved on the same kind of machine */
+extern struct sd_ast *
+sd_ast_load(const uint8_t *data, size_t size);
+
+/* sd_ast_render - renders a parsed document with any set of callbacks, */
+/* the way sd_markdown_render would. The document is parsed with every */
+/* element enabled: where a renderer leaves a callback NULL, blocks are */
+/* left out and spans are printed verbatim around their rendered content */
+/* rather than parsed as text, and the other elements are reduced to */
+/* their text; the same goes for elements the callbacks turn down */
+extern void
+sd_ast_render(struct buf *ob, const struct sd_ast *ast,
+	const struct sd_callbacks *callbacks, void *opaque);
+
+/* sd_ast_iter_init - starts a pull iteration over the tree, which must */
+/* stay unchanged while it goes on */
+extern void
+sd_ast_iter_init(struct sd_ast_iter *iter, const struct sd_ast *ast);
+
+/* sd_next_event - fills ev with the next event of the document, */
+/* returns 0 once the document is over */
+extern int
+sd_next_event(struct sd_ast_iter *iter, struct sd_event *ev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/* vim: set filetype=c: */
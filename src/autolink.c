@@ -48,114 +48,273 @@ sd_autolink_issafe(const uint8_t *link, size_t link_len)
 	return 0;
 }
 
-static size_t
-autolink_delim(uint8_t *data, size_t link_end, size_t max_rewind, size_t size)
+/* sd_scheme_trie: compiled set of safe link prefixes */
+/*	the trie is stored as a transition table over the bytes used by */
+/*	the prefixes, folded to lower case; node 0 is the root and also */
+/*	stands for "no transition", since no edge leads back to the root */
+struct sd_scheme_trie {
+	uint8_t map[256];	/* byte -> column, 0 for unused bytes */
+	size_t width;		/* columns per node */
+	size_t node_count;
+	unsigned int *next;	/* node_count * width transitions */
+	uint8_t *final;		/* whether a prefix ends on the node */
+};
+
+struct sd_scheme_trie *
+sd_scheme_trie_new(const char **schemes, size_t count)
 {
-	uint8_t cclose, copen = 0;
-	size_t i;
-
-	for (i = 0; i < link_end; ++i)
-		if (data[i] == '<') {
-			link_end = i;
-			break;
+	struct sd_scheme_trie *trie;
+	size_t i, j, max_nodes = 1;
+
+	trie = calloc(1, sizeof(struct sd_scheme_trie));
+	if (!trie)
+		return NULL;
+
+	/* one column for each distinct byte, letters sharing their case */
+	trie->width = 1;
+	for (i = 0; i < count; ++i) {
+		for (j = 0; schemes[i][j]; ++j) {
+			uint8_t c = tolower((uint8_t)schemes[i][j]);
+
+			if (!trie->map[c]) {
+				trie->map[c] = trie->width++;
+				trie->map[toupper(c)] = trie->map[c];
+			}
 		}
+		max_nodes += j;
+	}
 
-	while (link_end > 0) {
-		if (strchr("?!.,", data[link_end - 1]) != NULL)
-			link_end--;
+	trie->next = calloc(max_nodes * trie->width, sizeof(unsigned int));
+	trie->final = calloc(max_nodes, 1);
+	if (!trie->next || !trie->final) {
+		sd_scheme_trie_free(trie);
+		return NULL;
+	}
+
+	trie->node_count = 1;
+	for (i = 0; i < count; ++i) {
+		unsigned int node = 0;
 
-		else if (data[link_end - 1] == ';') {
-			size_t new_end = link_end - 2;
+		if (!schemes[i][0])
+			continue;
 
-			while (new_end > 0 && isalpha(data[new_end]))
-				new_end--;
+		for (j = 0; schemes[i][j]; ++j) {
+			unsigned int *edge = &trie->next[node * trie->width +
+				trie->map[(uint8_t)schemes[i][j]]];
 
-			if (new_end < link_end - 2 && data[new_end] == '&')
-				link_end = new_end;
-			else
-				link_end--;
+			if (!*edge)
+				*edge = trie->node_count++;
+			node = *edge;
 		}
-		else break;
+
+		trie->final[node] = 1;
 	}
 
-	if (link_end == 0)
-		return 0;
+	return trie;
+}
 
-	cclose = data[link_end - 1];
+void
+sd_scheme_trie_free(struct sd_scheme_trie *trie)
+{
+	if (!trie)
+		return;
 
-	switch (cclose) {
-	case '"':	copen = '"'; break;
-	case '\'':	copen = '\''; break;
-	case ')':	copen = '('; break;
-	case ']':	copen = '['; break;
-	case '}':	copen = '{'; break;
-	}
+	free(trie->next);
+	free(trie->final);
+	free(trie);
+}
 
-	if (copen != 0) {
-		size_t closing = 0;
-		size_t opening = 0;
-		size_t i = 0;
-
-		/* Try to close the final punctuation sign in this same line;
-		 * if we managed to close it outside of the URL, that means that it's
-		 * not part of the URL. If it closes inside the URL, that means it
-		 * is part of the URL.
-		 *
-		 * Examples:
-		 *
-		 *	foo http://www.pokemon.com/Pikachu_(Electric) bar
-		 *		=> http://www.pokemon.com/Pikachu_(Electric)
-		 *
-		 *	foo (http://www.pokemon.com/Pikachu_(Electric)) bar
-		 *		=> http://www.pokemon.com/Pikachu_(Electric)
-		 *
-		 *	foo http://www.pokemon.com/Pikachu_(Electric)) bar
-		 *		=> http://www.pokemon.com/Pikachu_(Electric))
-		 *
-		 *	(foo http://www.pokemon.com/Pikachu_(Electric)) bar
-		 *		=> foo http://www.pokemon.com/Pikachu_(Electric)
-		 */
-
-		while (i < link_end) {
-			if (data[i] == copen)
-				opening++;
-			else if (data[i] == cclose)
-				closing++;
-
-			i++;
-		}
+int
+sd_autolink_issafe_trie(const struct sd_scheme_trie *trie, const uint8_t *link, size_t link_len)
+{
+	unsigned int node = 0;
+	size_t i;
+
+	/* same rule as sd_autolink_issafe: a prefix followed by an alnum */
+	for (i = 0; i + 1 < link_len; ++i) {
+		node = trie->next[node * trie->width + trie->map[link[i]]];
 
-		if (closing != opening)
-			link_end--;
+		if (!node)
+			return 0;
+
+		if (trie->final[node] && isalnum(link[i + 1]))
+			return 1;
 	}
 
-	return link_end;
+	return 0;
 }
 
+/* character classes of the autolink recognizer */
+enum {
+	/* plain characters, the link goes on up to them */
+	AL_OTHER,
+	AL_ALPHA,
+	AL_DIGIT,
+	AL_DASH,
+	AL_QUOTE,
+	AL_AT,
+	AL_PLUS,
+	AL_UNDERSCORE,
+
+	/* characters needing care */
+	AL_DOT,
+	AL_TRAIL,	/* '?', '!' and ',', trimmed from the end of links */
+	AL_NUL,
+	AL_SEMI,
+	AL_AMP,
+	AL_PAREN_O,
+	AL_PAREN_C,
+	AL_BRACK_O,
+	AL_BRACK_C,
+	AL_BRACE_O,
+	AL_BRACE_C,
+
+	/* characters ending the link */
+	AL_SPACE,
+	AL_LT,
+
+	AL_CLASS_COUNT
+};
+
+static const uint8_t AUTOLINK_CLASS[] = {
+	10, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	19, 9, 4, 0, 0, 0, 12, 4, 13, 14, 0, 6, 9, 3, 8, 0,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 11, 20, 0, 0, 9,
+	5, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 15, 0, 16, 0, 7,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17, 0, 18, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/* states of the autolink recognizer */
+enum {
+	AS_DOMAIN,	/* leading run of domain characters */
+	AS_PATH,	/* anything else up to a space */
+	AS_AMP,		/* right after a '&' */
+	AS_ENTITY,	/* '&' followed by letters, ended by ';' */
+	AS_END,
+	AS_STATE_COUNT = AS_END
+};
+
+static const uint8_t AUTOLINK_NEXT[AS_STATE_COUNT][AL_CLASS_COUNT] = {
+	/* AS_DOMAIN */
+	{ AS_PATH, AS_DOMAIN, AS_DOMAIN, AS_DOMAIN, AS_PATH, AS_PATH, AS_PATH,
+	  AS_PATH, AS_DOMAIN, AS_PATH, AS_PATH, AS_PATH, AS_AMP, AS_PATH,
+	  AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_END, AS_END },
+	/* AS_PATH */
+	{ AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_PATH,
+	  AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_AMP, AS_PATH,
+	  AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_END, AS_END },
+	/* AS_AMP */
+	{ AS_PATH, AS_ENTITY, AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_PATH,
+	  AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_AMP, AS_PATH,
+	  AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_END, AS_END },
+	/* AS_ENTITY */
+	{ AS_PATH, AS_ENTITY, AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_PATH,
+	  AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_AMP, AS_PATH,
+	  AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_PATH, AS_END, AS_END },
+};
+
+/*
+ * autolink_scan • recognizes the domain and path of a link in one pass
+ *
+ * The scan starts on the first domain character and runs up to the first
+ * space or '<'. Along the way it keeps track of where the link would end
+ * once trailing punctuation and entities are trimmed. Brackets always
+ * move that end, so the running bracket balance is also the balance up
+ * to it, and the only rewind left is dropping a trailing unbalanced
+ * bracket or quote.
+ *
+ * Returns the length of the link from data, or 0 when the domain has no
+ * dot and short domains are not allowed.
+ */
 static size_t
-check_domain(uint8_t *data, size_t size, int allow_short)
+autolink_scan(uint8_t *data, size_t start, size_t size, int allow_short)
 {
-	size_t i, np = 0;
+	size_t i, keep = start, amp_keep = 0, np = 0;
+	int depth[3] = { 0, 0, 0 };
+	uint8_t state = AS_DOMAIN, prev, cls;
 
-	if (!isalnum(data[0]))
+	if (start >= size || !isalnum(data[start]))
 		return 0;
 
-	for (i = 1; i < size - 1; ++i) {
-		if (data[i] == '.') np++;
-		else if (!isalnum(data[i]) && data[i] != '-') break;
+	for (i = start; i < size; ++i) {
+		cls = AUTOLINK_CLASS[data[i]];
+
+		/* runs of plain characters in the path only move the end */
+		if (state == AS_PATH && cls < AL_DOT) {
+			while (i + 1 < size && AUTOLINK_CLASS[data[i + 1]] < AL_DOT)
+				i++;
+			keep = i + 1;
+			continue;
+		}
+
+		prev = state;
+		state = AUTOLINK_NEXT[state][cls];
+
+		if (state == AS_END)
+			break;
+
+		switch (cls) {
+		case AL_DOT:
+			/* the very last byte is never taken as part of the domain */
+			if (prev == AS_DOMAIN && i + 1 < size)
+				np++;
+			break;
+
+		case AL_TRAIL:
+		case AL_NUL:
+			break;
+
+		case AL_SEMI:
+			/* a trailing entity is trimmed as a whole */
+			if (prev == AS_ENTITY)
+				keep = amp_keep;
+			break;
+
+		case AL_AMP:
+			amp_keep = keep;
+			keep = i + 1;
+			break;
+
+		case AL_PAREN_O: case AL_PAREN_C:
+		case AL_BRACK_O: case AL_BRACK_C:
+		case AL_BRACE_O: case AL_BRACE_C:
+			depth[(cls - AL_PAREN_O) / 2] += ((cls - AL_PAREN_O) % 2) ? -1 : 1;
+			/* fall through */
+
+		default: /* plain characters outside of the path */
+			keep = i + 1;
+			break;
+		}
 	}
 
-	if (allow_short) {
-		/* We don't need a valid domain in the strict sense (with
-		 * least one dot; so just make sure it's composed of valid
-		 * domain characters and return the length of the the valid
-		 * sequence. */
-		return i;
-	} else {
-		/* a valid domain needs to have at least a dot.
-		 * that's as far as we get */
-		return np ? i : 0;
+	if (np == 0 && !allow_short)
+		return 0;
+
+	/* a closing sign is only kept when it closes inside the link; */
+	/* quotes never do */
+	switch (AUTOLINK_CLASS[data[keep - 1]]) {
+	case AL_QUOTE:
+		keep--;
+		break;
+
+	case AL_PAREN_C: case AL_BRACK_C: case AL_BRACE_C:
+		if (depth[(AUTOLINK_CLASS[data[keep - 1]] - AL_PAREN_O) / 2] != 0)
+			keep--;
+		break;
 	}
+
+	return keep;
 }
 
 size_t
@@ -175,15 +334,7 @@ sd_autolink__www(
 	if (size < 4 || memcmp(data, "www.", strlen("www.")) != 0)
 		return 0;
 
-	link_end = check_domain(data, size, 0);
-
-	if (link_end == 0)
-		return 0;
-
-	while (link_end < size && !isspace(data[link_end]))
-		link_end++;
-
-	link_end = autolink_delim(data, link_end, max_rewind, size);
+	link_end = autolink_scan(data, 0, size, 0);
 
 	if (link_end == 0)
 		return 0;
@@ -207,14 +358,12 @@ sd_autolink__email(
 	int nb = 0, np = 0;
 
 	for (rewind = 0; rewind < max_rewind; ++rewind) {
-		uint8_t c = data[-rewind - 1];
-
-		if (isalnum(c))
+		switch (AUTOLINK_CLASS[data[-rewind - 1]]) {
+		case AL_ALPHA: case AL_DIGIT:
+		case AL_DOT: case AL_PLUS: case AL_DASH: case AL_UNDERSCORE:
+		case AL_NUL:
 			continue;
-
-		if (strchr(".+-_", c) != NULL)
-			continue;
-
+		}
 		break;
 	}
 
@@ -222,26 +371,20 @@ sd_autolink__email(
 		return 0;
 
 	for (link_end = 0; link_end < size; ++link_end) {
-		uint8_t c = data[link_end];
-
-		if (isalnum(c))
-			continue;
+		uint8_t cls = AUTOLINK_CLASS[data[link_end]];
 
-		if (c == '@')
+		if (cls == AL_AT)
 			nb++;
-		else if (c == '.' && link_end < size - 1)
+		else if (cls == AL_DOT && link_end < size - 1)
 			np++;
-		else if (c != '-' && c != '_')
+		else if (cls != AL_ALPHA && cls != AL_DIGIT &&
+			cls != AL_DASH && cls != AL_UNDERSCORE)
 			break;
 	}
 
+	/* ending on a letter, the address has nothing left to trim */
 	if (link_end < 2 || nb != 1 || np == 0 ||
-		!isalpha(data[link_end - 1]))
-		return 0;
-
-	link_end = autolink_delim(data, link_end, max_rewind, size);
-
-	if (link_end == 0)
+		AUTOLINK_CLASS[data[link_end - 1]] != AL_ALPHA)
 		return 0;
 
 	bufput(link, data - rewind, link_end + rewind);
@@ -250,6 +393,21 @@ sd_autolink__email(
 	return link_end;
 }
 
+/* autolink_scheme • whether the letters are one of the linked schemes */
+static int
+autolink_scheme(const uint8_t *scheme, size_t len)
+{
+	switch (len) {
+	case 3:
+		return strncasecmp((char *)scheme, "ftp", 3) == 0;
+	case 4:
+		return strncasecmp((char *)scheme, "http", 4) == 0;
+	case 5:
+		return strncasecmp((char *)scheme, "https", 5) == 0;
+	}
+	return 0;
+}
+
 size_t
 sd_autolink__url(
 	size_t *rewind_p,
@@ -259,33 +417,20 @@ sd_autolink__url(
 	size_t size,
 	unsigned int flags)
 {
-	size_t link_end, rewind = 0, domain_len;
+	size_t link_end, rewind = 0;
 
 	if (size < 4 || data[1] != '/' || data[2] != '/')
 		return 0;
 
-	while (rewind < max_rewind && isalpha(data[-rewind - 1]))
+	while (rewind < max_rewind && AUTOLINK_CLASS[data[-rewind - 1]] == AL_ALPHA)
 		rewind++;
 
-	if (!sd_autolink_issafe(data - rewind, size + rewind))
+	if (!autolink_scheme(data - rewind, rewind))
 		return 0;
 
-	link_end = strlen("://");
-
-	domain_len = check_domain(
-		data + link_end,
-		size - link_end,
+	link_end = autolink_scan(data, strlen("://"), size,
 		flags & SD_AUTOLINK_SHORT_DOMAINS);
 
-	if (domain_len == 0)
-		return 0;
-
-	link_end += domain_len;
-	while (link_end < size && !isspace(data[link_end]))
-		link_end++;
-
-	link_end = autolink_delim(data, link_end, max_rewind, size);
-
 	if (link_end == 0)
 		return 0;
 
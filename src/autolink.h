@@ -27,9 +27,22 @@ enum {
 	SD_AUTOLINK_SHORT_DOMAINS = (1 << 0),
 };
 
+struct sd_scheme_trie;
+
 int
 sd_autolink_issafe(const uint8_t *link, size_t link_len);
 
+/* sd_scheme_trie_new: compiles case-insensitive safe link prefixes, */
+/* such as "http://" or "ticket:", for sd_autolink_issafe_trie */
+struct sd_scheme_trie *
+sd_scheme_trie_new(const char **schemes, size_t count);
+
+void
+sd_scheme_trie_free(struct sd_scheme_trie *trie);
+
+int
+sd_autolink_issafe_trie(const struct sd_scheme_trie *trie, const uint8_t *link, size_t link_len);
+
 size_t
 sd_autolink__www(size_t *rewind_p, struct buf *link,
 	uint8_t *data, size_t offset, size_t size, unsigned int flags);
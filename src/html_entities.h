@@ -0,0 +1,4894 @@
+/* C code produced by gen_entities.py */
+/* Command-line: gen_entities.py html_entity_names.txt */
+
+#define ENTITY_COUNT 2125
+#define ENTITY_MIN_LENGTH 2
+#define ENTITY_MAX_LENGTH 31
+#define ENTITY_SLOTS 2656
+#define ENTITY_BUCKETS 708
+
+struct html_entity {
+	unsigned short name;	/* offset in entity_names */
+	unsigned char size;	/* length of the name, 0 for free slots */
+	char utf8[7];		/* NUL-terminated value */
+};
+
+static const char entity_names[] =
+	"AElig\0"
+	"AMP\0"
+	"Aacute\0"
+	"Abreve\0"
+	"Acirc\0"
+	"Acy\0"
+	"Afr\0"
+	"Agrave\0"
+	"Alpha\0"
+	"Amacr\0"
+	"And\0"
+	"Aogon\0"
+	"Aopf\0"
+	"ApplyFunction\0"
+	"Aring\0"
+	"Ascr\0"
+	"Assign\0"
+	"Atilde\0"
+	"Auml\0"
+	"Backslash\0"
+	"Barv\0"
+	"Barwed\0"
+	"Bcy\0"
+	"Because\0"
+	"Bernoullis\0"
+	"Beta\0"
+	"Bfr\0"
+	"Bopf\0"
+	"Breve\0"
+	"Bscr\0"
+	"Bumpeq\0"
+	"CHcy\0"
+	"COPY\0"
+	"Cacute\0"
+	"Cap\0"
+	"CapitalDifferentialD\0"
+	"Cayleys\0"
+	"Ccaron\0"
+	"Ccedil\0"
+	"Ccirc\0"
+	"Cconint\0"
+	"Cdot\0"
+	"Cedilla\0"
+	"CenterDot\0"
+	"Cfr\0"
+	"Chi\0"
+	"CircleDot\0"
+	"CircleMinus\0"
+	"CirclePlus\0"
+	"CircleTimes\0"
+	"ClockwiseContourIntegral\0"
+	"CloseCurlyDoubleQuote\0"
+	"CloseCurlyQuote\0"
+	"Colon\0"
+	"Colone\0"
+	"Congruent\0"
+	"Conint\0"
+	"ContourIntegral\0"
+	"Copf\0"
+	"Coproduct\0"
+	"CounterClockwiseContourIntegral\0"
+	"Cross\0"
+	"Cscr\0"
+	"Cup\0"
+	"CupCap\0"
+	"DD\0"
+	"DDotrahd\0"
+	"DJcy\0"
+	"DScy\0"
+	"DZcy\0"
+	"Dagger\0"
+	"Darr\0"
+	"Dashv\0"
+	"Dcaron\0"
+	"Dcy\0"
+	"Del\0"
+	"Delta\0"
+	"Dfr\0"
+	"DiacriticalAcute\0"
+	"DiacriticalDot\0"
+	"DiacriticalDoubleAcute\0"
+	"DiacriticalGrave\0"
+	"DiacriticalTilde\0"
+	"Diamond\0"
+	"DifferentialD\0"
+	"Dopf\0"
+	"Dot\0"
+	"DotDot\0"
+	"DotEqual\0"
+	"DoubleContourIntegral\0"
+	"DoubleDot\0"
+	"DoubleDownArrow\0"
+	"DoubleLeftArrow\0"
+	"DoubleLeftRightArrow\0"
+	"DoubleLeftTee\0"
+	"DoubleLongLeftArrow\0"
+	"DoubleLongLeftRightArrow\0"
+	"DoubleLongRightArrow\0"
+	"DoubleRightArrow\0"
+	"DoubleRightTee\0"
+	"DoubleUpArrow\0"
+	"DoubleUpDownArrow\0"
+	"DoubleVerticalBar\0"
+	"DownArrow\0"
+	"DownArrowBar\0"
+	"DownArrowUpArrow\0"
+	"DownBreve\0"
+	"DownLeftRightVector\0"
+	"DownLeftTeeVector\0"
+	"DownLeftVector\0"
+	"DownLeftVectorBar\0"
+	"DownRightTeeVector\0"
+	"DownRightVector\0"
+	"DownRightVectorBar\0"
+	"DownTee\0"
+	"DownTeeArrow\0"
+	"Downarrow\0"
+	"Dscr\0"
+	"Dstrok\0"
+	"ENG\0"
+	"ETH\0"
+	"Eacute\0"
+	"Ecaron\0"
+	"Ecirc\0"
+	"Ecy\0"
+	"Edot\0"
+	"Efr\0"
+	"Egrave\0"
+	"Element\0"
+	"Emacr\0"
+	"EmptySmallSquare\0"
+	"EmptyVerySmallSquare\0"
+	"Eogon\0"
+	"Eopf\0"
+	"Epsilon\0"
+	"Equal\0"
+	"EqualTilde\0"
+	"Equilibrium\0"
+	"Escr\0"
+	"Esim\0"
+	"Eta\0"
+	"Euml\0"
+	"Exists\0"
+	"ExponentialE\0"
+	"Fcy\0"
+	"Ffr\0"
+	"FilledSmallSquare\0"
+	"FilledVerySmallSquare\0"
+	"Fopf\0"
+	"ForAll\0"
+	"Fouriertrf\0"
+	"Fscr\0"
+	"GJcy\0"
+	"GT\0"
+	"Gamma\0"
+	"Gammad\0"
+	"Gbreve\0"
+	"Gcedil\0"
+	"Gcirc\0"
+	"Gcy\0"
+	"Gdot\0"
+	"Gfr\0"
+	"Gg\0"
+	"Gopf\0"
+	"GreaterEqual\0"
+	"GreaterEqualLess\0"
+	"GreaterFullEqual\0"
+	"GreaterGreater\0"
+	"GreaterLess\0"
+	"GreaterSlantEqual\0"
+	"GreaterTilde\0"
+	"Gscr\0"
+	"Gt\0"
+	"HARDcy\0"
+	"Hacek\0"
+	"Hat\0"
+	"Hcirc\0"
+	"Hfr\0"
+	"HilbertSpace\0"
+	"Hopf\0"
+	"HorizontalLine\0"
+	"Hscr\0"
+	"Hstrok\0"
+	"HumpDownHump\0"
+	"HumpEqual\0"
+	"IEcy\0"
+	"IJlig\0"
+	"IOcy\0"
+	"Iacute\0"
+	"Icirc\0"
+	"Icy\0"
+	"Idot\0"
+	"Ifr\0"
+	"Igrave\0"
+	"Im\0"
+	"Imacr\0"
+	"ImaginaryI\0"
+	"Implies\0"
+	"Int\0"
+	"Integral\0"
+	"Intersection\0"
+	"InvisibleComma\0"
+	"InvisibleTimes\0"
+	"Iogon\0"
+	"Iopf\0"
+	"Iota\0"
+	"Iscr\0"
+	"Itilde\0"
+	"Iukcy\0"
+	"Iuml\0"
+	"Jcirc\0"
+	"Jcy\0"
+	"Jfr\0"
+	"Jopf\0"
+	"Jscr\0"
+	"Jsercy\0"
+	"Jukcy\0"
+	"KHcy\0"
+	"KJcy\0"
+	"Kappa\0"
+	"Kcedil\0"
+	"Kcy\0"
+	"Kfr\0"
+	"Kopf\0"
+	"Kscr\0"
+	"LJcy\0"
+	"LT\0"
+	"Lacute\0"
+	"Lambda\0"
+	"Lang\0"
+	"Laplacetrf\0"
+	"Larr\0"
+	"Lcaron\0"
+	"Lcedil\0"
+	"Lcy\0"
+	"LeftAngleBracket\0"
+	"LeftArrow\0"
+	"LeftArrowBar\0"
+	"LeftArrowRightArrow\0"
+	"LeftCeiling\0"
+	"LeftDoubleBracket\0"
+	"LeftDownTeeVector\0"
+	"LeftDownVector\0"
+	"LeftDownVectorBar\0"
+	"LeftFloor\0"
+	"LeftRightArrow\0"
+	"LeftRightVector\0"
+	"LeftTee\0"
+	"LeftTeeArrow\0"
+	"LeftTeeVector\0"
+	"LeftTriangle\0"
+	"LeftTriangleBar\0"
+	"LeftTriangleEqual\0"
+	"LeftUpDownVector\0"
+	"LeftUpTeeVector\0"
+	"LeftUpVector\0"
+	"LeftUpVectorBar\0"
+	"LeftVector\0"
+	"LeftVectorBar\0"
+	"Leftarrow\0"
+	"Leftrightarrow\0"
+	"LessEqualGreater\0"
+	"LessFullEqual\0"
+	"LessGreater\0"
+	"LessLess\0"
+	"LessSlantEqual\0"
+	"LessTilde\0"
+	"Lfr\0"
+	"Ll\0"
+	"Lleftarrow\0"
+	"Lmidot\0"
+	"LongLeftArrow\0"
+	"LongLeftRightArrow\0"
+	"LongRightArrow\0"
+	"Longleftarrow\0"
+	"Longleftrightarrow\0"
+	"Longrightarrow\0"
+	"Lopf\0"
+	"LowerLeftArrow\0"
+	"LowerRightArrow\0"
+	"Lscr\0"
+	"Lsh\0"
+	"Lstrok\0"
+	"Lt\0"
+	"Map\0"
+	"Mcy\0"
+	"MediumSpace\0"
+	"Mellintrf\0"
+	"Mfr\0"
+	"MinusPlus\0"
+	"Mopf\0"
+	"Mscr\0"
+	"Mu\0"
+	"NJcy\0"
+	"Nacute\0"
+	"Ncaron\0"
+	"Ncedil\0"
+	"Ncy\0"
+	"NegativeMediumSpace\0"
+	"NegativeThickSpace\0"
+	"NegativeThinSpace\0"
+	"NegativeVeryThinSpace\0"
+	"NestedGreaterGreater\0"
+	"NestedLessLess\0"
+	"NewLine\0"
+	"Nfr\0"
+	"NoBreak\0"
+	"NonBreakingSpace\0"
+	"Nopf\0"
+	"Not\0"
+	"NotCongruent\0"
+	"NotCupCap\0"
+	"NotDoubleVerticalBar\0"
+	"NotElement\0"
+	"NotEqual\0"
+	"NotEqualTilde\0"
+	"NotExists\0"
+	"NotGreater\0"
+	"NotGreaterEqual\0"
+	"NotGreaterFullEqual\0"
+	"NotGreaterGreater\0"
+	"NotGreaterLess\0"
+	"NotGreaterSlantEqual\0"
+	"NotGreaterTilde\0"
+	"NotHumpDownHump\0"
+	"NotHumpEqual\0"
+	"NotLeftTriangle\0"
+	"NotLeftTriangleBar\0"
+	"NotLeftTriangleEqual\0"
+	"NotLess\0"
+	"NotLessEqual\0"
+	"NotLessGreater\0"
+	"NotLessLess\0"
+	"NotLessSlantEqual\0"
+	"NotLessTilde\0"
+	"NotNestedGreaterGreater\0"
+	"NotNestedLessLess\0"
+	"NotPrecedes\0"
+	"NotPrecedesEqual\0"
+	"NotPrecedesSlantEqual\0"
+	"NotReverseElement\0"
+	"NotRightTriangle\0"
+	"NotRightTriangleBar\0"
+	"NotRightTriangleEqual\0"
+	"NotSquareSubset\0"
+	"NotSquareSubsetEqual\0"
+	"NotSquareSuperset\0"
+	"NotSquareSupersetEqual\0"
+	"NotSubset\0"
+	"NotSubsetEqual\0"
+	"NotSucceeds\0"
+	"NotSucceedsEqual\0"
+	"NotSucceedsSlantEqual\0"
+	"NotSucceedsTilde\0"
+	"NotSuperset\0"
+	"NotSupersetEqual\0"
+	"NotTilde\0"
+	"NotTildeEqual\0"
+	"NotTildeFullEqual\0"
+	"NotTildeTilde\0"
+	"NotVerticalBar\0"
+	"Nscr\0"
+	"Ntilde\0"
+	"Nu\0"
+	"OElig\0"
+	"Oacute\0"
+	"Ocirc\0"
+	"Ocy\0"
+	"Odblac\0"
+	"Ofr\0"
+	"Ograve\0"
+	"Omacr\0"
+	"Omega\0"
+	"Omicron\0"
+	"Oopf\0"
+	"OpenCurlyDoubleQuote\0"
+	"OpenCurlyQuote\0"
+	"Or\0"
+	"Oscr\0"
+	"Oslash\0"
+	"Otilde\0"
+	"Otimes\0"
+	"Ouml\0"
+	"OverBar\0"
+	"OverBrace\0"
+	"OverBracket\0"
+	"OverParenthesis\0"
+	"PartialD\0"
+	"Pcy\0"
+	"Pfr\0"
+	"Phi\0"
+	"Pi\0"
+	"PlusMinus\0"
+	"Poincareplane\0"
+	"Popf\0"
+	"Pr\0"
+	"Precedes\0"
+	"PrecedesEqual\0"
+	"PrecedesSlantEqual\0"
+	"PrecedesTilde\0"
+	"Prime\0"
+	"Product\0"
+	"Proportion\0"
+	"Proportional\0"
+	"Pscr\0"
+	"Psi\0"
+	"QUOT\0"
+	"Qfr\0"
+	"Qopf\0"
+	"Qscr\0"
+	"RBarr\0"
+	"REG\0"
+	"Racute\0"
+	"Rang\0"
+	"Rarr\0"
+	"Rarrtl\0"
+	"Rcaron\0"
+	"Rcedil\0"
+	"Rcy\0"
+	"Re\0"
+	"ReverseElement\0"
+	"ReverseEquilibrium\0"
+	"ReverseUpEquilibrium\0"
+	"Rfr\0"
+	"Rho\0"
+	"RightAngleBracket\0"
+	"RightArrow\0"
+	"RightArrowBar\0"
+	"RightArrowLeftArrow\0"
+	"RightCeiling\0"
+	"RightDoubleBracket\0"
+	"RightDownTeeVector\0"
+	"RightDownVector\0"
+	"RightDownVectorBar\0"
+	"RightFloor\0"
+	"RightTee\0"
+	"RightTeeArrow\0"
+	"RightTeeVector\0"
+	"RightTriangle\0"
+	"RightTriangleBar\0"
+	"RightTriangleEqual\0"
+	"RightUpDownVector\0"
+	"RightUpTeeVector\0"
+	"RightUpVector\0"
+	"RightUpVectorBar\0"
+	"RightVector\0"
+	"RightVectorBar\0"
+	"Rightarrow\0"
+	"Ropf\0"
+	"RoundImplies\0"
+	"Rrightarrow\0"
+	"Rscr\0"
+	"Rsh\0"
+	"RuleDelayed\0"
+	"SHCHcy\0"
+	"SHcy\0"
+	"SOFTcy\0"
+	"Sacute\0"
+	"Sc\0"
+	"Scaron\0"
+	"Scedil\0"
+	"Scirc\0"
+	"Scy\0"
+	"Sfr\0"
+	"ShortDownArrow\0"
+	"ShortLeftArrow\0"
+	"ShortRightArrow\0"
+	"ShortUpArrow\0"
+	"Sigma\0"
+	"SmallCircle\0"
+	"Sopf\0"
+	"Sqrt\0"
+	"Square\0"
+	"SquareIntersection\0"
+	"SquareSubset\0"
+	"SquareSubsetEqual\0"
+	"SquareSuperset\0"
+	"SquareSupersetEqual\0"
+	"SquareUnion\0"
+	"Sscr\0"
+	"Star\0"
+	"Sub\0"
+	"Subset\0"
+	"SubsetEqual\0"
+	"Succeeds\0"
+	"SucceedsEqual\0"
+	"SucceedsSlantEqual\0"
+	"SucceedsTilde\0"
+	"SuchThat\0"
+	"Sum\0"
+	"Sup\0"
+	"Superset\0"
+	"SupersetEqual\0"
+	"Supset\0"
+	"THORN\0"
+	"TRADE\0"
+	"TSHcy\0"
+	"TScy\0"
+	"Tab\0"
+	"Tau\0"
+	"Tcaron\0"
+	"Tcedil\0"
+	"Tcy\0"
+	"Tfr\0"
+	"Therefore\0"
+	"Theta\0"
+	"ThickSpace\0"
+	"ThinSpace\0"
+	"Tilde\0"
+	"TildeEqual\0"
+	"TildeFullEqual\0"
+	"TildeTilde\0"
+	"Topf\0"
+	"TripleDot\0"
+	"Tscr\0"
+	"Tstrok\0"
+	"Uacute\0"
+	"Uarr\0"
+	"Uarrocir\0"
+	"Ubrcy\0"
+	"Ubreve\0"
+	"Ucirc\0"
+	"Ucy\0"
+	"Udblac\0"
+	"Ufr\0"
+	"Ugrave\0"
+	"Umacr\0"
+	"UnderBar\0"
+	"UnderBrace\0"
+	"UnderBracket\0"
+	"UnderParenthesis\0"
+	"Union\0"
+	"UnionPlus\0"
+	"Uogon\0"
+	"Uopf\0"
+	"UpArrow\0"
+	"UpArrowBar\0"
+	"UpArrowDownArrow\0"
+	"UpDownArrow\0"
+	"UpEquilibrium\0"
+	"UpTee\0"
+	"UpTeeArrow\0"
+	"Uparrow\0"
+	"Updownarrow\0"
+	"UpperLeftArrow\0"
+	"UpperRightArrow\0"
+	"Upsi\0"
+	"Upsilon\0"
+	"Uring\0"
+	"Uscr\0"
+	"Utilde\0"
+	"Uuml\0"
+	"VDash\0"
+	"Vbar\0"
+	"Vcy\0"
+	"Vdash\0"
+	"Vdashl\0"
+	"Vee\0"
+	"Verbar\0"
+	"Vert\0"
+	"VerticalBar\0"
+	"VerticalLine\0"
+	"VerticalSeparator\0"
+	"VerticalTilde\0"
+	"VeryThinSpace\0"
+	"Vfr\0"
+	"Vopf\0"
+	"Vscr\0"
+	"Vvdash\0"
+	"Wcirc\0"
+	"Wedge\0"
+	"Wfr\0"
+	"Wopf\0"
+	"Wscr\0"
+	"Xfr\0"
+	"Xi\0"
+	"Xopf\0"
+	"Xscr\0"
+	"YAcy\0"
+	"YIcy\0"
+	"YUcy\0"
+	"Yacute\0"
+	"Ycirc\0"
+	"Ycy\0"
+	"Yfr\0"
+	"Yopf\0"
+	"Yscr\0"
+	"Yuml\0"
+	"ZHcy\0"
+	"Zacute\0"
+	"Zcaron\0"
+	"Zcy\0"
+	"Zdot\0"
+	"ZeroWidthSpace\0"
+	"Zeta\0"
+	"Zfr\0"
+	"Zopf\0"
+	"Zscr\0"
+	"aacute\0"
+	"abreve\0"
+	"ac\0"
+	"acE\0"
+	"acd\0"
+	"acirc\0"
+	"acute\0"
+	"acy\0"
+	"aelig\0"
+	"af\0"
+	"afr\0"
+	"agrave\0"
+	"alefsym\0"
+	"aleph\0"
+	"alpha\0"
+	"amacr\0"
+	"amalg\0"
+	"amp\0"
+	"and\0"
+	"andand\0"
+	"andd\0"
+	"andslope\0"
+	"andv\0"
+	"ang\0"
+	"ange\0"
+	"angle\0"
+	"angmsd\0"
+	"angmsdaa\0"
+	"angmsdab\0"
+	"angmsdac\0"
+	"angmsdad\0"
+	"angmsdae\0"
+	"angmsdaf\0"
+	"angmsdag\0"
+	"angmsdah\0"
+	"angrt\0"
+	"angrtvb\0"
+	"angrtvbd\0"
+	"angsph\0"
+	"angst\0"
+	"angzarr\0"
+	"aogon\0"
+	"aopf\0"
+	"ap\0"
+	"apE\0"
+	"apacir\0"
+	"ape\0"
+	"apid\0"
+	"apos\0"
+	"approx\0"
+	"approxeq\0"
+	"aring\0"
+	"ascr\0"
+	"ast\0"
+	"asymp\0"
+	"asympeq\0"
+	"atilde\0"
+	"auml\0"
+	"awconint\0"
+	"awint\0"
+	"bNot\0"
+	"backcong\0"
+	"backepsilon\0"
+	"backprime\0"
+	"backsim\0"
+	"backsimeq\0"
+	"barvee\0"
+	"barwed\0"
+	"barwedge\0"
+	"bbrk\0"
+	"bbrktbrk\0"
+	"bcong\0"
+	"bcy\0"
+	"bdquo\0"
+	"becaus\0"
+	"because\0"
+	"bemptyv\0"
+	"bepsi\0"
+	"bernou\0"
+	"beta\0"
+	"beth\0"
+	"between\0"
+	"bfr\0"
+	"bigcap\0"
+	"bigcirc\0"
+	"bigcup\0"
+	"bigodot\0"
+	"bigoplus\0"
+	"bigotimes\0"
+	"bigsqcup\0"
+	"bigstar\0"
+	"bigtriangledown\0"
+	"bigtriangleup\0"
+	"biguplus\0"
+	"bigvee\0"
+	"bigwedge\0"
+	"bkarow\0"
+	"blacklozenge\0"
+	"blacksquare\0"
+	"blacktriangle\0"
+	"blacktriangledown\0"
+	"blacktriangleleft\0"
+	"blacktriangleright\0"
+	"blank\0"
+	"blk12\0"
+	"blk14\0"
+	"blk34\0"
+	"block\0"
+	"bne\0"
+	"bnequiv\0"
+	"bnot\0"
+	"bopf\0"
+	"bot\0"
+	"bottom\0"
+	"bowtie\0"
+	"boxDL\0"
+	"boxDR\0"
+	"boxDl\0"
+	"boxDr\0"
+	"boxH\0"
+	"boxHD\0"
+	"boxHU\0"
+	"boxHd\0"
+	"boxHu\0"
+	"boxUL\0"
+	"boxUR\0"
+	"boxUl\0"
+	"boxUr\0"
+	"boxV\0"
+	"boxVH\0"
+	"boxVL\0"
+	"boxVR\0"
+	"boxVh\0"
+	"boxVl\0"
+	"boxVr\0"
+	"boxbox\0"
+	"boxdL\0"
+	"boxdR\0"
+	"boxdl\0"
+	"boxdr\0"
+	"boxh\0"
+	"boxhD\0"
+	"boxhU\0"
+	"boxhd\0"
+	"boxhu\0"
+	"boxminus\0"
+	"boxplus\0"
+	"boxtimes\0"
+	"boxuL\0"
+	"boxuR\0"
+	"boxul\0"
+	"boxur\0"
+	"boxv\0"
+	"boxvH\0"
+	"boxvL\0"
+	"boxvR\0"
+	"boxvh\0"
+	"boxvl\0"
+	"boxvr\0"
+	"bprime\0"
+	"breve\0"
+	"brvbar\0"
+	"bscr\0"
+	"bsemi\0"
+	"bsim\0"
+	"bsime\0"
+	"bsol\0"
+	"bsolb\0"
+	"bsolhsub\0"
+	"bull\0"
+	"bullet\0"
+	"bump\0"
+	"bumpE\0"
+	"bumpe\0"
+	"bumpeq\0"
+	"cacute\0"
+	"cap\0"
+	"capand\0"
+	"capbrcup\0"
+	"capcap\0"
+	"capcup\0"
+	"capdot\0"
+	"caps\0"
+	"caret\0"
+	"caron\0"
+	"ccaps\0"
+	"ccaron\0"
+	"ccedil\0"
+	"ccirc\0"
+	"ccups\0"
+	"ccupssm\0"
+	"cdot\0"
+	"cedil\0"
+	"cemptyv\0"
+	"cent\0"
+	"centerdot\0"
+	"cfr\0"
+	"chcy\0"
+	"check\0"
+	"checkmark\0"
+	"chi\0"
+	"cir\0"
+	"cirE\0"
+	"circ\0"
+	"circeq\0"
+	"circlearrowleft\0"
+	"circlearrowright\0"
+	"circledR\0"
+	"circledS\0"
+	"circledast\0"
+	"circledcirc\0"
+	"circleddash\0"
+	"cire\0"
+	"cirfnint\0"
+	"cirmid\0"
+	"cirscir\0"
+	"clubs\0"
+	"clubsuit\0"
+	"colon\0"
+	"colone\0"
+	"coloneq\0"
+	"comma\0"
+	"commat\0"
+	"comp\0"
+	"compfn\0"
+	"complement\0"
+	"complexes\0"
+	"cong\0"
+	"congdot\0"
+	"conint\0"
+	"copf\0"
+	"coprod\0"
+	"copy\0"
+	"copysr\0"
+	"crarr\0"
+	"cross\0"
+	"cscr\0"
+	"csub\0"
+	"csube\0"
+	"csup\0"
+	"csupe\0"
+	"ctdot\0"
+	"cudarrl\0"
+	"cudarrr\0"
+	"cuepr\0"
+	"cuesc\0"
+	"cularr\0"
+	"cularrp\0"
+	"cup\0"
+	"cupbrcap\0"
+	"cupcap\0"
+	"cupcup\0"
+	"cupdot\0"
+	"cupor\0"
+	"cups\0"
+	"curarr\0"
+	"curarrm\0"
+	"curlyeqprec\0"
+	"curlyeqsucc\0"
+	"curlyvee\0"
+	"curlywedge\0"
+	"curren\0"
+	"curvearrowleft\0"
+	"curvearrowright\0"
+	"cuvee\0"
+	"cuwed\0"
+	"cwconint\0"
+	"cwint\0"
+	"cylcty\0"
+	"dArr\0"
+	"dHar\0"
+	"dagger\0"
+	"daleth\0"
+	"darr\0"
+	"dash\0"
+	"dashv\0"
+	"dbkarow\0"
+	"dblac\0"
+	"dcaron\0"
+	"dcy\0"
+	"dd\0"
+	"ddagger\0"
+	"ddarr\0"
+	"ddotseq\0"
+	"deg\0"
+	"delta\0"
+	"demptyv\0"
+	"dfisht\0"
+	"dfr\0"
+	"dharl\0"
+	"dharr\0"
+	"diam\0"
+	"diamond\0"
+	"diamondsuit\0"
+	"diams\0"
+	"die\0"
+	"digamma\0"
+	"disin\0"
+	"div\0"
+	"divide\0"
+	"divideontimes\0"
+	"divonx\0"
+	"djcy\0"
+	"dlcorn\0"
+	"dlcrop\0"
+	"dollar\0"
+	"dopf\0"
+	"dot\0"
+	"doteq\0"
+	"doteqdot\0"
+	"dotminus\0"
+	"dotplus\0"
+	"dotsquare\0"
+	"doublebarwedge\0"
+	"downarrow\0"
+	"downdownarrows\0"
+	"downharpoonleft\0"
+	"downharpoonright\0"
+	"drbkarow\0"
+	"drcorn\0"
+	"drcrop\0"
+	"dscr\0"
+	"dscy\0"
+	"dsol\0"
+	"dstrok\0"
+	"dtdot\0"
+	"dtri\0"
+	"dtrif\0"
+	"duarr\0"
+	"duhar\0"
+	"dwangle\0"
+	"dzcy\0"
+	"dzigrarr\0"
+	"eDDot\0"
+	"eDot\0"
+	"eacute\0"
+	"easter\0"
+	"ecaron\0"
+	"ecir\0"
+	"ecirc\0"
+	"ecolon\0"
+	"ecy\0"
+	"edot\0"
+	"ee\0"
+	"efDot\0"
+	"efr\0"
+	"eg\0"
+	"egrave\0"
+	"egs\0"
+	"egsdot\0"
+	"el\0"
+	"elinters\0"
+	"ell\0"
+	"els\0"
+	"elsdot\0"
+	"emacr\0"
+	"empty\0"
+	"emptyset\0"
+	"emptyv\0"
+	"emsp\0"
+	"emsp13\0"
+	"emsp14\0"
+	"eng\0"
+	"ensp\0"
+	"eogon\0"
+	"eopf\0"
+	"epar\0"
+	"eparsl\0"
+	"eplus\0"
+	"epsi\0"
+	"epsilon\0"
+	"epsiv\0"
+	"eqcirc\0"
+	"eqcolon\0"
+	"eqsim\0"
+	"eqslantgtr\0"
+	"eqslantless\0"
+	"equals\0"
+	"equest\0"
+	"equiv\0"
+	"equivDD\0"
+	"eqvparsl\0"
+	"erDot\0"
+	"erarr\0"
+	"escr\0"
+	"esdot\0"
+	"esim\0"
+	"eta\0"
+	"eth\0"
+	"euml\0"
+	"euro\0"
+	"excl\0"
+	"exist\0"
+	"expectation\0"
+	"exponentiale\0"
+	"fallingdotseq\0"
+	"fcy\0"
+	"female\0"
+	"ffilig\0"
+	"fflig\0"
+	"ffllig\0"
+	"ffr\0"
+	"filig\0"
+	"fjlig\0"
+	"flat\0"
+	"fllig\0"
+	"fltns\0"
+	"fnof\0"
+	"fopf\0"
+	"forall\0"
+	"fork\0"
+	"forkv\0"
+	"fpartint\0"
+	"frac12\0"
+	"frac13\0"
+	"frac14\0"
+	"frac15\0"
+	"frac16\0"
+	"frac18\0"
+	"frac23\0"
+	"frac25\0"
+	"frac34\0"
+	"frac35\0"
+	"frac38\0"
+	"frac45\0"
+	"frac56\0"
+	"frac58\0"
+	"frac78\0"
+	"frasl\0"
+	"frown\0"
+	"fscr\0"
+	"gE\0"
+	"gEl\0"
+	"gacute\0"
+	"gamma\0"
+	"gammad\0"
+	"gap\0"
+	"gbreve\0"
+	"gcirc\0"
+	"gcy\0"
+	"gdot\0"
+	"ge\0"
+	"gel\0"
+	"geq\0"
+	"geqq\0"
+	"geqslant\0"
+	"ges\0"
+	"gescc\0"
+	"gesdot\0"
+	"gesdoto\0"
+	"gesdotol\0"
+	"gesl\0"
+	"gesles\0"
+	"gfr\0"
+	"gg\0"
+	"ggg\0"
+	"gimel\0"
+	"gjcy\0"
+	"gl\0"
+	"glE\0"
+	"gla\0"
+	"glj\0"
+	"gnE\0"
+	"gnap\0"
+	"gnapprox\0"
+	"gne\0"
+	"gneq\0"
+	"gneqq\0"
+	"gnsim\0"
+	"gopf\0"
+	"grave\0"
+	"gscr\0"
+	"gsim\0"
+	"gsime\0"
+	"gsiml\0"
+	"gt\0"
+	"gtcc\0"
+	"gtcir\0"
+	"gtdot\0"
+	"gtlPar\0"
+	"gtquest\0"
+	"gtrapprox\0"
+	"gtrarr\0"
+	"gtrdot\0"
+	"gtreqless\0"
+	"gtreqqless\0"
+	"gtrless\0"
+	"gtrsim\0"
+	"gvertneqq\0"
+	"gvnE\0"
+	"hArr\0"
+	"hairsp\0"
+	"half\0"
+	"hamilt\0"
+	"hardcy\0"
+	"harr\0"
+	"harrcir\0"
+	"harrw\0"
+	"hbar\0"
+	"hcirc\0"
+	"hearts\0"
+	"heartsuit\0"
+	"hellip\0"
+	"hercon\0"
+	"hfr\0"
+	"hksearow\0"
+	"hkswarow\0"
+	"hoarr\0"
+	"homtht\0"
+	"hookleftarrow\0"
+	"hookrightarrow\0"
+	"hopf\0"
+	"horbar\0"
+	"hscr\0"
+	"hslash\0"
+	"hstrok\0"
+	"hybull\0"
+	"hyphen\0"
+	"iacute\0"
+	"ic\0"
+	"icirc\0"
+	"icy\0"
+	"iecy\0"
+	"iexcl\0"
+	"iff\0"
+	"ifr\0"
+	"igrave\0"
+	"ii\0"
+	"iiiint\0"
+	"iiint\0"
+	"iinfin\0"
+	"iiota\0"
+	"ijlig\0"
+	"imacr\0"
+	"image\0"
+	"imagline\0"
+	"imagpart\0"
+	"imath\0"
+	"imof\0"
+	"imped\0"
+	"in\0"
+	"incare\0"
+	"infin\0"
+	"infintie\0"
+	"inodot\0"
+	"int\0"
+	"intcal\0"
+	"integers\0"
+	"intercal\0"
+	"intlarhk\0"
+	"intprod\0"
+	"iocy\0"
+	"iogon\0"
+	"iopf\0"
+	"iota\0"
+	"iprod\0"
+	"iquest\0"
+	"iscr\0"
+	"isin\0"
+	"isinE\0"
+	"isindot\0"
+	"isins\0"
+	"isinsv\0"
+	"isinv\0"
+	"it\0"
+	"itilde\0"
+	"iukcy\0"
+	"iuml\0"
+	"jcirc\0"
+	"jcy\0"
+	"jfr\0"
+	"jmath\0"
+	"jopf\0"
+	"jscr\0"
+	"jsercy\0"
+	"jukcy\0"
+	"kappa\0"
+	"kappav\0"
+	"kcedil\0"
+	"kcy\0"
+	"kfr\0"
+	"kgreen\0"
+	"khcy\0"
+	"kjcy\0"
+	"kopf\0"
+	"kscr\0"
+	"lAarr\0"
+	"lArr\0"
+	"lAtail\0"
+	"lBarr\0"
+	"lE\0"
+	"lEg\0"
+	"lHar\0"
+	"lacute\0"
+	"laemptyv\0"
+	"lagran\0"
+	"lambda\0"
+	"lang\0"
+	"langd\0"
+	"langle\0"
+	"lap\0"
+	"laquo\0"
+	"larr\0"
+	"larrb\0"
+	"larrbfs\0"
+	"larrfs\0"
+	"larrhk\0"
+	"larrlp\0"
+	"larrpl\0"
+	"larrsim\0"
+	"larrtl\0"
+	"lat\0"
+	"latail\0"
+	"late\0"
+	"lates\0"
+	"lbarr\0"
+	"lbbrk\0"
+	"lbrace\0"
+	"lbrack\0"
+	"lbrke\0"
+	"lbrksld\0"
+	"lbrkslu\0"
+	"lcaron\0"
+	"lcedil\0"
+	"lceil\0"
+	"lcub\0"
+	"lcy\0"
+	"ldca\0"
+	"ldquo\0"
+	"ldquor\0"
+	"ldrdhar\0"
+	"ldrushar\0"
+	"ldsh\0"
+	"le\0"
+	"leftarrow\0"
+	"leftarrowtail\0"
+	"leftharpoondown\0"
+	"leftharpoonup\0"
+	"leftleftarrows\0"
+	"leftrightarrow\0"
+	"leftrightarrows\0"
+	"leftrightharpoons\0"
+	"leftrightsquigarrow\0"
+	"leftthreetimes\0"
+	"leg\0"
+	"leq\0"
+	"leqq\0"
+	"leqslant\0"
+	"les\0"
+	"lescc\0"
+	"lesdot\0"
+	"lesdoto\0"
+	"lesdotor\0"
+	"lesg\0"
+	"lesges\0"
+	"lessapprox\0"
+	"lessdot\0"
+	"lesseqgtr\0"
+	"lesseqqgtr\0"
+	"lessgtr\0"
+	"lesssim\0"
+	"lfisht\0"
+	"lfloor\0"
+	"lfr\0"
+	"lg\0"
+	"lgE\0"
+	"lhard\0"
+	"lharu\0"
+	"lharul\0"
+	"lhblk\0"
+	"ljcy\0"
+	"ll\0"
+	"llarr\0"
+	"llcorner\0"
+	"llhard\0"
+	"lltri\0"
+	"lmidot\0"
+	"lmoust\0"
+	"lmoustache\0"
+	"lnE\0"
+	"lnap\0"
+	"lnapprox\0"
+	"lne\0"
+	"lneq\0"
+	"lneqq\0"
+	"lnsim\0"
+	"loang\0"
+	"loarr\0"
+	"lobrk\0"
+	"longleftarrow\0"
+	"longleftrightarrow\0"
+	"longmapsto\0"
+	"longrightarrow\0"
+	"looparrowleft\0"
+	"looparrowright\0"
+	"lopar\0"
+	"lopf\0"
+	"loplus\0"
+	"lotimes\0"
+	"lowast\0"
+	"lowbar\0"
+	"loz\0"
+	"lozenge\0"
+	"lozf\0"
+	"lpar\0"
+	"lparlt\0"
+	"lrarr\0"
+	"lrcorner\0"
+	"lrhar\0"
+	"lrhard\0"
+	"lrm\0"
+	"lrtri\0"
+	"lsaquo\0"
+	"lscr\0"
+	"lsh\0"
+	"lsim\0"
+	"lsime\0"
+	"lsimg\0"
+	"lsqb\0"
+	"lsquo\0"
+	"lsquor\0"
+	"lstrok\0"
+	"lt\0"
+	"ltcc\0"
+	"ltcir\0"
+	"ltdot\0"
+	"lthree\0"
+	"ltimes\0"
+	"ltlarr\0"
+	"ltquest\0"
+	"ltrPar\0"
+	"ltri\0"
+	"ltrie\0"
+	"ltrif\0"
+	"lurdshar\0"
+	"luruhar\0"
+	"lvertneqq\0"
+	"lvnE\0"
+	"mDDot\0"
+	"macr\0"
+	"male\0"
+	"malt\0"
+	"maltese\0"
+	"map\0"
+	"mapsto\0"
+	"mapstodown\0"
+	"mapstoleft\0"
+	"mapstoup\0"
+	"marker\0"
+	"mcomma\0"
+	"mcy\0"
+	"mdash\0"
+	"measuredangle\0"
+	"mfr\0"
+	"mho\0"
+	"micro\0"
+	"mid\0"
+	"midast\0"
+	"midcir\0"
+	"middot\0"
+	"minus\0"
+	"minusb\0"
+	"minusd\0"
+	"minusdu\0"
+	"mlcp\0"
+	"mldr\0"
+	"mnplus\0"
+	"models\0"
+	"mopf\0"
+	"mp\0"
+	"mscr\0"
+	"mstpos\0"
+	"mu\0"
+	"multimap\0"
+	"mumap\0"
+	"nGg\0"
+	"nGt\0"
+	"nGtv\0"
+	"nLeftarrow\0"
+	"nLeftrightarrow\0"
+	"nLl\0"
+	"nLt\0"
+	"nLtv\0"
+	"nRightarrow\0"
+	"nVDash\0"
+	"nVdash\0"
+	"nabla\0"
+	"nacute\0"
+	"nang\0"
+	"nap\0"
+	"napE\0"
+	"napid\0"
+	"napos\0"
+	"napprox\0"
+	"natur\0"
+	"natural\0"
+	"naturals\0"
+	"nbsp\0"
+	"nbump\0"
+	"nbumpe\0"
+	"ncap\0"
+	"ncaron\0"
+	"ncedil\0"
+	"ncong\0"
+	"ncongdot\0"
+	"ncup\0"
+	"ncy\0"
+	"ndash\0"
+	"ne\0"
+	"neArr\0"
+	"nearhk\0"
+	"nearr\0"
+	"nearrow\0"
+	"nedot\0"
+	"nequiv\0"
+	"nesear\0"
+	"nesim\0"
+	"nexist\0"
+	"nexists\0"
+	"nfr\0"
+	"ngE\0"
+	"nge\0"
+	"ngeq\0"
+	"ngeqq\0"
+	"ngeqslant\0"
+	"nges\0"
+	"ngsim\0"
+	"ngt\0"
+	"ngtr\0"
+	"nhArr\0"
+	"nharr\0"
+	"nhpar\0"
+	"ni\0"
+	"nis\0"
+	"nisd\0"
+	"niv\0"
+	"njcy\0"
+	"nlArr\0"
+	"nlE\0"
+	"nlarr\0"
+	"nldr\0"
+	"nle\0"
+	"nleftarrow\0"
+	"nleftrightarrow\0"
+	"nleq\0"
+	"nleqq\0"
+	"nleqslant\0"
+	"nles\0"
+	"nless\0"
+	"nlsim\0"
+	"nlt\0"
+	"nltri\0"
+	"nltrie\0"
+	"nmid\0"
+	"nopf\0"
+	"not\0"
+	"notin\0"
+	"notinE\0"
+	"notindot\0"
+	"notinva\0"
+	"notinvb\0"
+	"notinvc\0"
+	"notni\0"
+	"notniva\0"
+	"notnivb\0"
+	"notnivc\0"
+	"npar\0"
+	"nparallel\0"
+	"nparsl\0"
+	"npart\0"
+	"npolint\0"
+	"npr\0"
+	"nprcue\0"
+	"npre\0"
+	"nprec\0"
+	"npreceq\0"
+	"nrArr\0"
+	"nrarr\0"
+	"nrarrc\0"
+	"nrarrw\0"
+	"nrightarrow\0"
+	"nrtri\0"
+	"nrtrie\0"
+	"nsc\0"
+	"nsccue\0"
+	"nsce\0"
+	"nscr\0"
+	"nshortmid\0"
+	"nshortparallel\0"
+	"nsim\0"
+	"nsime\0"
+	"nsimeq\0"
+	"nsmid\0"
+	"nspar\0"
+	"nsqsube\0"
+	"nsqsupe\0"
+	"nsub\0"
+	"nsubE\0"
+	"nsube\0"
+	"nsubset\0"
+	"nsubseteq\0"
+	"nsubseteqq\0"
+	"nsucc\0"
+	"nsucceq\0"
+	"nsup\0"
+	"nsupE\0"
+	"nsupe\0"
+	"nsupset\0"
+	"nsupseteq\0"
+	"nsupseteqq\0"
+	"ntgl\0"
+	"ntilde\0"
+	"ntlg\0"
+	"ntriangleleft\0"
+	"ntrianglelefteq\0"
+	"ntriangleright\0"
+	"ntrianglerighteq\0"
+	"nu\0"
+	"num\0"
+	"numero\0"
+	"numsp\0"
+	"nvDash\0"
+	"nvHarr\0"
+	"nvap\0"
+	"nvdash\0"
+	"nvge\0"
+	"nvgt\0"
+	"nvinfin\0"
+	"nvlArr\0"
+	"nvle\0"
+	"nvlt\0"
+	"nvltrie\0"
+	"nvrArr\0"
+	"nvrtrie\0"
+	"nvsim\0"
+	"nwArr\0"
+	"nwarhk\0"
+	"nwarr\0"
+	"nwarrow\0"
+	"nwnear\0"
+	"oS\0"
+	"oacute\0"
+	"oast\0"
+	"ocir\0"
+	"ocirc\0"
+	"ocy\0"
+	"odash\0"
+	"odblac\0"
+	"odiv\0"
+	"odot\0"
+	"odsold\0"
+	"oelig\0"
+	"ofcir\0"
+	"ofr\0"
+	"ogon\0"
+	"ograve\0"
+	"ogt\0"
+	"ohbar\0"
+	"ohm\0"
+	"oint\0"
+	"olarr\0"
+	"olcir\0"
+	"olcross\0"
+	"oline\0"
+	"olt\0"
+	"omacr\0"
+	"omega\0"
+	"omicron\0"
+	"omid\0"
+	"ominus\0"
+	"oopf\0"
+	"opar\0"
+	"operp\0"
+	"oplus\0"
+	"or\0"
+	"orarr\0"
+	"ord\0"
+	"order\0"
+	"orderof\0"
+	"ordf\0"
+	"ordm\0"
+	"origof\0"
+	"oror\0"
+	"orslope\0"
+	"orv\0"
+	"oscr\0"
+	"oslash\0"
+	"osol\0"
+	"otilde\0"
+	"otimes\0"
+	"otimesas\0"
+	"ouml\0"
+	"ovbar\0"
+	"par\0"
+	"para\0"
+	"parallel\0"
+	"parsim\0"
+	"parsl\0"
+	"part\0"
+	"pcy\0"
+	"percnt\0"
+	"period\0"
+	"permil\0"
+	"perp\0"
+	"pertenk\0"
+	"pfr\0"
+	"phi\0"
+	"phiv\0"
+	"phmmat\0"
+	"phone\0"
+	"pi\0"
+	"pitchfork\0"
+	"piv\0"
+	"planck\0"
+	"planckh\0"
+	"plankv\0"
+	"plus\0"
+	"plusacir\0"
+	"plusb\0"
+	"pluscir\0"
+	"plusdo\0"
+	"plusdu\0"
+	"pluse\0"
+	"plusmn\0"
+	"plussim\0"
+	"plustwo\0"
+	"pm\0"
+	"pointint\0"
+	"popf\0"
+	"pound\0"
+	"pr\0"
+	"prE\0"
+	"prap\0"
+	"prcue\0"
+	"pre\0"
+	"prec\0"
+	"precapprox\0"
+	"preccurlyeq\0"
+	"preceq\0"
+	"precnapprox\0"
+	"precneqq\0"
+	"precnsim\0"
+	"precsim\0"
+	"prime\0"
+	"primes\0"
+	"prnE\0"
+	"prnap\0"
+	"prnsim\0"
+	"prod\0"
+	"profalar\0"
+	"profline\0"
+	"profsurf\0"
+	"prop\0"
+	"propto\0"
+	"prsim\0"
+	"prurel\0"
+	"pscr\0"
+	"psi\0"
+	"puncsp\0"
+	"qfr\0"
+	"qint\0"
+	"qopf\0"
+	"qprime\0"
+	"qscr\0"
+	"quaternions\0"
+	"quatint\0"
+	"quest\0"
+	"questeq\0"
+	"quot\0"
+	"rAarr\0"
+	"rArr\0"
+	"rAtail\0"
+	"rBarr\0"
+	"rHar\0"
+	"race\0"
+	"racute\0"
+	"radic\0"
+	"raemptyv\0"
+	"rang\0"
+	"rangd\0"
+	"range\0"
+	"rangle\0"
+	"raquo\0"
+	"rarr\0"
+	"rarrap\0"
+	"rarrb\0"
+	"rarrbfs\0"
+	"rarrc\0"
+	"rarrfs\0"
+	"rarrhk\0"
+	"rarrlp\0"
+	"rarrpl\0"
+	"rarrsim\0"
+	"rarrtl\0"
+	"rarrw\0"
+	"ratail\0"
+	"ratio\0"
+	"rationals\0"
+	"rbarr\0"
+	"rbbrk\0"
+	"rbrace\0"
+	"rbrack\0"
+	"rbrke\0"
+	"rbrksld\0"
+	"rbrkslu\0"
+	"rcaron\0"
+	"rcedil\0"
+	"rceil\0"
+	"rcub\0"
+	"rcy\0"
+	"rdca\0"
+	"rdldhar\0"
+	"rdquo\0"
+	"rdquor\0"
+	"rdsh\0"
+	"real\0"
+	"realine\0"
+	"realpart\0"
+	"reals\0"
+	"rect\0"
+	"reg\0"
+	"rfisht\0"
+	"rfloor\0"
+	"rfr\0"
+	"rhard\0"
+	"rharu\0"
+	"rharul\0"
+	"rho\0"
+	"rhov\0"
+	"rightarrow\0"
+	"rightarrowtail\0"
+	"rightharpoondown\0"
+	"rightharpoonup\0"
+	"rightleftarrows\0"
+	"rightleftharpoons\0"
+	"rightrightarrows\0"
+	"rightsquigarrow\0"
+	"rightthreetimes\0"
+	"ring\0"
+	"risingdotseq\0"
+	"rlarr\0"
+	"rlhar\0"
+	"rlm\0"
+	"rmoust\0"
+	"rmoustache\0"
+	"rnmid\0"
+	"roang\0"
+	"roarr\0"
+	"robrk\0"
+	"ropar\0"
+	"ropf\0"
+	"roplus\0"
+	"rotimes\0"
+	"rpar\0"
+	"rpargt\0"
+	"rppolint\0"
+	"rrarr\0"
+	"rsaquo\0"
+	"rscr\0"
+	"rsh\0"
+	"rsqb\0"
+	"rsquo\0"
+	"rsquor\0"
+	"rthree\0"
+	"rtimes\0"
+	"rtri\0"
+	"rtrie\0"
+	"rtrif\0"
+	"rtriltri\0"
+	"ruluhar\0"
+	"rx\0"
+	"sacute\0"
+	"sbquo\0"
+	"sc\0"
+	"scE\0"
+	"scap\0"
+	"scaron\0"
+	"sccue\0"
+	"sce\0"
+	"scedil\0"
+	"scirc\0"
+	"scnE\0"
+	"scnap\0"
+	"scnsim\0"
+	"scpolint\0"
+	"scsim\0"
+	"scy\0"
+	"sdot\0"
+	"sdotb\0"
+	"sdote\0"
+	"seArr\0"
+	"searhk\0"
+	"searr\0"
+	"searrow\0"
+	"sect\0"
+	"semi\0"
+	"seswar\0"
+	"setminus\0"
+	"setmn\0"
+	"sext\0"
+	"sfr\0"
+	"sfrown\0"
+	"sharp\0"
+	"shchcy\0"
+	"shcy\0"
+	"shortmid\0"
+	"shortparallel\0"
+	"shy\0"
+	"sigma\0"
+	"sigmaf\0"
+	"sigmav\0"
+	"sim\0"
+	"simdot\0"
+	"sime\0"
+	"simeq\0"
+	"simg\0"
+	"simgE\0"
+	"siml\0"
+	"simlE\0"
+	"simne\0"
+	"simplus\0"
+	"simrarr\0"
+	"slarr\0"
+	"smallsetminus\0"
+	"smashp\0"
+	"smeparsl\0"
+	"smid\0"
+	"smile\0"
+	"smt\0"
+	"smte\0"
+	"smtes\0"
+	"softcy\0"
+	"sol\0"
+	"solb\0"
+	"solbar\0"
+	"sopf\0"
+	"spades\0"
+	"spadesuit\0"
+	"spar\0"
+	"sqcap\0"
+	"sqcaps\0"
+	"sqcup\0"
+	"sqcups\0"
+	"sqsub\0"
+	"sqsube\0"
+	"sqsubset\0"
+	"sqsubseteq\0"
+	"sqsup\0"
+	"sqsupe\0"
+	"sqsupset\0"
+	"sqsupseteq\0"
+	"squ\0"
+	"square\0"
+	"squarf\0"
+	"squf\0"
+	"srarr\0"
+	"sscr\0"
+	"ssetmn\0"
+	"ssmile\0"
+	"sstarf\0"
+	"star\0"
+	"starf\0"
+	"straightepsilon\0"
+	"straightphi\0"
+	"strns\0"
+	"sub\0"
+	"subE\0"
+	"subdot\0"
+	"sube\0"
+	"subedot\0"
+	"submult\0"
+	"subnE\0"
+	"subne\0"
+	"subplus\0"
+	"subrarr\0"
+	"subset\0"
+	"subseteq\0"
+	"subseteqq\0"
+	"subsetneq\0"
+	"subsetneqq\0"
+	"subsim\0"
+	"subsub\0"
+	"subsup\0"
+	"succ\0"
+	"succapprox\0"
+	"succcurlyeq\0"
+	"succeq\0"
+	"succnapprox\0"
+	"succneqq\0"
+	"succnsim\0"
+	"succsim\0"
+	"sum\0"
+	"sung\0"
+	"sup\0"
+	"sup1\0"
+	"sup2\0"
+	"sup3\0"
+	"supE\0"
+	"supdot\0"
+	"supdsub\0"
+	"supe\0"
+	"supedot\0"
+	"suphsol\0"
+	"suphsub\0"
+	"suplarr\0"
+	"supmult\0"
+	"supnE\0"
+	"supne\0"
+	"supplus\0"
+	"supset\0"
+	"supseteq\0"
+	"supseteqq\0"
+	"supsetneq\0"
+	"supsetneqq\0"
+	"supsim\0"
+	"supsub\0"
+	"supsup\0"
+	"swArr\0"
+	"swarhk\0"
+	"swarr\0"
+	"swarrow\0"
+	"swnwar\0"
+	"szlig\0"
+	"target\0"
+	"tau\0"
+	"tbrk\0"
+	"tcaron\0"
+	"tcedil\0"
+	"tcy\0"
+	"tdot\0"
+	"telrec\0"
+	"tfr\0"
+	"there4\0"
+	"therefore\0"
+	"theta\0"
+	"thetasym\0"
+	"thetav\0"
+	"thickapprox\0"
+	"thicksim\0"
+	"thinsp\0"
+	"thkap\0"
+	"thksim\0"
+	"thorn\0"
+	"tilde\0"
+	"times\0"
+	"timesb\0"
+	"timesbar\0"
+	"timesd\0"
+	"tint\0"
+	"toea\0"
+	"top\0"
+	"topbot\0"
+	"topcir\0"
+	"topf\0"
+	"topfork\0"
+	"tosa\0"
+	"tprime\0"
+	"trade\0"
+	"triangle\0"
+	"triangledown\0"
+	"triangleleft\0"
+	"trianglelefteq\0"
+	"triangleq\0"
+	"triangleright\0"
+	"trianglerighteq\0"
+	"tridot\0"
+	"trie\0"
+	"triminus\0"
+	"triplus\0"
+	"trisb\0"
+	"tritime\0"
+	"trpezium\0"
+	"tscr\0"
+	"tscy\0"
+	"tshcy\0"
+	"tstrok\0"
+	"twixt\0"
+	"twoheadleftarrow\0"
+	"twoheadrightarrow\0"
+	"uArr\0"
+	"uHar\0"
+	"uacute\0"
+	"uarr\0"
+	"ubrcy\0"
+	"ubreve\0"
+	"ucirc\0"
+	"ucy\0"
+	"udarr\0"
+	"udblac\0"
+	"udhar\0"
+	"ufisht\0"
+	"ufr\0"
+	"ugrave\0"
+	"uharl\0"
+	"uharr\0"
+	"uhblk\0"
+	"ulcorn\0"
+	"ulcorner\0"
+	"ulcrop\0"
+	"ultri\0"
+	"umacr\0"
+	"uml\0"
+	"uogon\0"
+	"uopf\0"
+	"uparrow\0"
+	"updownarrow\0"
+	"upharpoonleft\0"
+	"upharpoonright\0"
+	"uplus\0"
+	"upsi\0"
+	"upsih\0"
+	"upsilon\0"
+	"upuparrows\0"
+	"urcorn\0"
+	"urcorner\0"
+	"urcrop\0"
+	"uring\0"
+	"urtri\0"
+	"uscr\0"
+	"utdot\0"
+	"utilde\0"
+	"utri\0"
+	"utrif\0"
+	"uuarr\0"
+	"uuml\0"
+	"uwangle\0"
+	"vArr\0"
+	"vBar\0"
+	"vBarv\0"
+	"vDash\0"
+	"vangrt\0"
+	"varepsilon\0"
+	"varkappa\0"
+	"varnothing\0"
+	"varphi\0"
+	"varpi\0"
+	"varpropto\0"
+	"varr\0"
+	"varrho\0"
+	"varsigma\0"
+	"varsubsetneq\0"
+	"varsubsetneqq\0"
+	"varsupsetneq\0"
+	"varsupsetneqq\0"
+	"vartheta\0"
+	"vartriangleleft\0"
+	"vartriangleright\0"
+	"vcy\0"
+	"vdash\0"
+	"vee\0"
+	"veebar\0"
+	"veeeq\0"
+	"vellip\0"
+	"verbar\0"
+	"vert\0"
+	"vfr\0"
+	"vltri\0"
+	"vnsub\0"
+	"vnsup\0"
+	"vopf\0"
+	"vprop\0"
+	"vrtri\0"
+	"vscr\0"
+	"vsubnE\0"
+	"vsubne\0"
+	"vsupnE\0"
+	"vsupne\0"
+	"vzigzag\0"
+	"wcirc\0"
+	"wedbar\0"
+	"wedge\0"
+	"wedgeq\0"
+	"weierp\0"
+	"wfr\0"
+	"wopf\0"
+	"wp\0"
+	"wr\0"
+	"wreath\0"
+	"wscr\0"
+	"xcap\0"
+	"xcirc\0"
+	"xcup\0"
+	"xdtri\0"
+	"xfr\0"
+	"xhArr\0"
+	"xharr\0"
+	"xi\0"
+	"xlArr\0"
+	"xlarr\0"
+	"xmap\0"
+	"xnis\0"
+	"xodot\0"
+	"xopf\0"
+	"xoplus\0"
+	"xotime\0"
+	"xrArr\0"
+	"xrarr\0"
+	"xscr\0"
+	"xsqcup\0"
+	"xuplus\0"
+	"xutri\0"
+	"xvee\0"
+	"xwedge\0"
+	"yacute\0"
+	"yacy\0"
+	"ycirc\0"
+	"ycy\0"
+	"yen\0"
+	"yfr\0"
+	"yicy\0"
+	"yopf\0"
+	"yscr\0"
+	"yucy\0"
+	"yuml\0"
+	"zacute\0"
+	"zcaron\0"
+	"zcy\0"
+	"zdot\0"
+	"zeetrf\0"
+	"zeta\0"
+	"zfr\0"
+	"zhcy\0"
+	"zigrarr\0"
+	"zopf\0"
+	"zscr\0"
+	"zwj\0"
+	"zwnj\0"
+	;
+
+static const unsigned short entity_seeds[ENTITY_BUCKETS] = {
+	3, 66, 15, 3, 6, 64, 10, 10, 4, 0, 6, 2,
+	1, 1, 1, 4, 1, 2, 14, 32, 2, 11, 3, 3,
+	1, 7, 1, 2, 2, 49, 2, 26, 7, 2, 1, 1,
+	17, 7, 14, 6, 2, 11, 8, 7, 24, 6, 5, 5,
+	5, 5, 1, 2, 2, 7, 1, 3, 2, 18, 12, 0,
+	76, 1, 6, 10, 1, 3, 0, 2, 2, 4, 6, 13,
+	1, 69, 10, 1, 1, 1, 2, 64, 5, 4, 1, 4,
+	6, 3, 1, 1, 3, 6, 1, 1, 4, 1, 1, 3,
+	26, 25, 6, 4, 8, 3, 9, 5, 10, 1, 20, 26,
+	1, 6, 10, 2, 1, 1, 5, 0, 1, 5, 0, 9,
+	2, 5, 1, 5, 7, 2, 1, 37, 3, 5, 2, 0,
+	45, 67, 4, 3, 16, 10, 2, 5, 19, 2, 2, 7,
+	1, 2, 0, 3, 0, 2, 6, 3, 3, 2, 19, 4,
+	17, 2, 4, 3, 4, 25, 1, 5, 1, 3, 3, 12,
+	2, 5, 21, 0, 0, 5, 3, 12, 12, 5, 22, 9,
+	66, 9, 1, 9, 2, 1, 17, 2, 1, 18, 2, 18,
+	102, 17, 2, 2, 5, 24, 1, 3, 9, 2, 3, 66,
+	4, 6, 2, 31, 32, 6, 7, 11, 76, 2, 0, 2,
+	19, 15, 19, 1, 4, 42, 26, 2, 6, 13, 3, 23,
+	13, 8, 3, 1, 5, 1, 1, 5, 11, 6, 4, 1,
+	1, 6, 0, 3, 2, 2, 5, 12, 0, 9, 1, 16,
+	2, 1, 55, 15, 1, 2, 10, 3, 77, 17, 6, 1,
+	7, 1, 1, 5, 2, 3, 5, 2, 10, 22, 68, 8,
+	6, 28, 8, 5, 17, 2, 3, 14, 1, 1, 3, 26,
+	3, 1, 1, 67, 1, 9, 1, 1, 66, 4, 4, 3,
+	2, 0, 1, 7, 5, 1, 10, 20, 14, 66, 66, 1,
+	1, 6, 49, 6, 13, 0, 10, 1, 0, 0, 1, 1,
+	3, 3, 3, 7, 9, 18, 1, 4, 5, 72, 1, 1,
+	2, 1, 26, 11, 0, 4, 5, 1, 7, 1, 17, 5,
+	1, 1, 1, 2, 14, 14, 0, 5, 22, 0, 29, 3,
+	1, 15, 4, 12, 5, 3, 1, 5, 2, 27, 6, 8,
+	0, 1, 14, 1, 0, 0, 8, 3, 12, 12, 9, 2,
+	1, 6, 1, 1, 6, 6, 80, 73, 4, 17, 2, 13,
+	7, 6, 8, 4, 7, 4, 0, 64, 13, 27, 1, 6,
+	11, 3, 3, 7, 6, 15, 1, 6, 1, 7, 37, 2,
+	2, 71, 0, 4, 22, 78, 4, 1, 2, 1, 1, 14,
+	11, 9, 3, 9, 30, 1, 20, 20, 1, 10, 17, 2,
+	4, 2, 12, 0, 2, 1, 23, 2, 1, 7, 7, 7,
+	34, 2, 10, 1, 2, 11, 24, 25, 5, 14, 17, 1,
+	11, 2, 3, 3, 1, 9, 43, 14, 29, 14, 2, 64,
+	10, 8, 30, 25, 9, 2, 1, 2, 28, 9, 82, 10,
+	7, 4, 13, 18, 3, 16, 0, 4, 19, 31, 2, 1,
+	64, 17, 3, 8, 12, 0, 0, 12, 4, 1, 66, 14,
+	39, 15, 2, 3, 72, 1, 18, 74, 18, 6, 2, 2,
+	4, 13, 1, 44, 2, 1, 34, 25, 1, 2, 2, 7,
+	10, 1, 53, 19, 7, 18, 66, 6, 3, 0, 93, 7,
+	18, 65, 79, 10, 61, 5, 11, 1, 6, 8, 28, 0,
+	34, 3, 11, 74, 80, 37, 68, 18, 59, 8, 8, 6,
+	1, 19, 24, 72, 20, 3, 11, 38, 65, 4, 5, 6,
+	0, 10, 7, 14, 4, 3, 5, 23, 3, 0, 43, 1,
+	7, 37, 38, 75, 0, 0, 1, 2, 3, 16, 4, 71,
+	1, 64, 5, 2, 1, 5, 14, 1, 1, 20, 6, 0,
+	1, 4, 80, 8, 3, 18, 6, 13, 4, 7, 50, 10,
+	1, 0, 2, 9, 7, 1, 5, 1, 3, 9, 1, 28,
+	3, 8, 65, 23, 47, 10, 85, 2, 1, 3, 12, 14,
+	1, 98, 70, 27, 3, 12, 2, 3, 17, 85, 4, 1,
+	65, 60, 33, 1, 16, 3, 4, 1, 3, 46, 39, 7,
+	7, 5, 6, 6, 51, 36, 14, 11, 85, 4, 68, 16,
+	23, 27, 6, 9, 1, 9, 20, 31, 6, 0, 4, 104,
+};
+
+static const struct html_entity entity_table[ENTITY_SLOTS] = {
+	{ 1363, 6, "\342\210\203" }, /* Exists */
+	{ 8603, 4, "\342\213\224" }, /* fork */
+	{ 0, 0, "" },
+	{ 3923, 8, "\342\210\202" }, /* PartialD */
+	{ 8928, 4, "\342\252\210" }, /* gneq */
+	{ 5866, 3, "\342\210\247" }, /* and */
+	{ 11296, 5, "\342\211\202\314\270" }, /* nesim */
+	{ 3588, 21, "\342\213\241" }, /* NotSucceedsSlantEqual */
+	{ 0, 0, "" },
+	{ 1473, 6, "\317\234" }, /* Gammad */
+	{ 0, 0, "" },
+	{ 7819, 5, "\342\231\246" }, /* diams */
+	{ 0, 0, "" },
+	{ 12649, 7, "\342\250\247" }, /* plustwo */
+	{ 6891, 4, "\360\235\222\267" }, /* bscr */
+	{ 7782, 5, "\342\207\203" }, /* dharl */
+	{ 7703, 7, "\342\244\217" }, /* dbkarow */
+	{ 11361, 3, "\342\211\257" }, /* ngt */
+	{ 1487, 6, "\304\242" }, /* Gcedil */
+	{ 10813, 7, "\342\234\240" }, /* maltese */
+	{ 193, 4, "\320\247" }, /* CHcy */
+	{ 6980, 6, "\342\251\204" }, /* capand */
+	{ 12096, 7, "\342\212\265\342\203\222" }, /* nvrtrie */
+	{ 6696, 5, "\342\225\240" }, /* boxVR */
+	{ 15046, 6, "\342\227\254" }, /* tridot */
+	{ 11425, 4, "\342\200\245" }, /* nldr */
+	{ 0, 0, "" },
+	{ 7472, 6, "\342\206\266" }, /* cularr */
+	{ 1513, 2, "\342\213\231" }, /* Gg */
+	{ 9762, 5, "\342\246\221" }, /* langd */
+	{ 12159, 4, "\342\212\232" }, /* ocir */
+	{ 6626, 4, "\342\225\220" }, /* boxH */
+	{ 1409, 21, "\342\226\252" }, /* FilledVerySmallSquare */
+	{ 4972, 3, "\342\213\221" }, /* Sup */
+	{ 11445, 15, "\342\206\256" }, /* nleftrightarrow */
+	{ 12372, 6, "\342\212\266" }, /* origof */
+	{ 5159, 6, "\305\246" }, /* Tstrok */
+	{ 6745, 5, "\342\224\214" }, /* boxdr */
+	{ 3976, 2, "\342\252\273" }, /* Pr */
+	{ 7843, 3, "\303\267" }, /* div */
+	{ 9623, 6, "\321\230" }, /* jsercy */
+	{ 10808, 4, "\342\234\240" }, /* malt */
+	{ 2511, 6, "\304\277" }, /* Lmidot */
+	{ 8998, 6, "\342\246\225" }, /* gtlPar */
+	{ 6806, 5, "\342\225\233" }, /* boxuL */
+	{ 1296, 5, "\304\230" }, /* Eogon */
+	{ 5509, 6, "\342\200\226" }, /* Verbar */
+	{ 7003, 6, "\342\251\207" }, /* capcup */
+	{ 4945, 13, "\342\211\277" }, /* SucceedsTilde */
+	{ 0, 0, "" },
+	{ 7717, 6, "\304\217" }, /* dcaron */
+	{ 10973, 4, "\342\200\246" }, /* mldr */
+	{ 12354, 7, "\342\204\264" }, /* orderof */
+	{ 5896, 3, "\342\210\240" }, /* ang */
+	{ 6739, 5, "\342\224\220" }, /* boxdl */
+	{ 24, 5, "\303\202" }, /* Acirc */
+	{ 9370, 5, "\304\253" }, /* imacr */
+	{ 5300, 5, "\305\262" }, /* Uogon */
+	{ 8857, 4, "\342\213\233\357\270\200" }, /* gesl */
+	{ 6620, 5, "\342\225\223" }, /* boxDr */
+	{ 8526, 6, "\342\231\200" }, /* female */
+	{ 9607, 5, "\310\267" }, /* jmath */
+	{ 7837, 5, "\342\213\262" }, /* disin */
+	{ 6751, 4, "\342\224\200" }, /* boxh */
+	{ 9768, 6, "\342\237\250" }, /* langle */
+	{ 1504, 4, "\304\240" }, /* Gdot */
+	{ 14080, 4, "\360\235\225\244" }, /* sopf */
+	{ 14228, 4, "\360\235\223\210" }, /* sscr */
+	{ 1302, 4, "\360\235\224\274" }, /* Eopf */
+	{ 1873, 4, "\316\231" }, /* Iota */
+	{ 10339, 6, "\342\245\253" }, /* llhard */
+	{ 12950, 4, "\342\207\222" }, /* rArr */
+	{ 5059, 9, "\342\210\264" }, /* Therefore */
+	{ 11000, 4, "\360\235\223\202" }, /* mscr */
+	{ 4142, 6, "\305\226" }, /* Rcedil */
+	{ 0, 0, "" },
+	{ 13882, 8, "\342\210\243" }, /* shortmid */
+	{ 11015, 8, "\342\212\270" }, /* multimap */
+	{ 12856, 6, "\342\212\260" }, /* prurel */
+	{ 0, 0, "" },
+	{ 11710, 5, "\342\213\253" }, /* nrtri */
+	{ 16110, 4, "\360\235\225\253" }, /* zopf */
+	{ 0, 0, "" },
+	{ 5936, 8, "\342\246\252" }, /* angmsdac */
+	{ 0, 0, "" },
+	{ 11526, 3, "\302\254" }, /* not */
+	{ 11867, 7, "\342\252\260\314\270" }, /* nsucceq */
+	{ 10960, 7, "\342\250\252" }, /* minusdu */
+	{ 3397, 16, "\342\213\253" }, /* NotRightTriangle */
+	{ 0, 0, "" },
+	{ 8586, 4, "\306\222" }, /* fnof */
+	{ 6608, 5, "\342\225\224" }, /* boxDR */
+	{ 9660, 3, "\360\235\224\250" }, /* kfr */
+	{ 15509, 10, "\317\265" }, /* varepsilon */
+	{ 7060, 5, "\342\251\214" }, /* ccups */
+	{ 10528, 4, "\360\235\225\235" }, /* lopf */
+	{ 2551, 14, "\342\237\266" }, /* LongRightArrow */
+	{ 15455, 5, "\342\226\264" }, /* utrif */
+	{ 8783, 5, "\304\235" }, /* gcirc */
+	{ 0, 0, "" },
+	{ 7977, 14, "\342\207\212" }, /* downdownarrows */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 10107, 19, "\342\206\255" }, /* leftrightsquigarrow */
+	{ 11646, 6, "\342\213\240" }, /* nprcue */
+	{ 5069, 5, "\316\230" }, /* Theta */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 7887, 6, "\342\214\215" }, /* dlcrop */
+	{ 15714, 6, "\174" }, /* verbar */
+	{ 12579, 6, "\342\204\217" }, /* plankv */
+	{ 13808, 7, "\342\206\230" }, /* searrow */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 4891, 11, "\342\212\206" }, /* SubsetEqual */
+	{ 5006, 5, "\303\236" }, /* THORN */
+	{ 0, 0, "" },
+	{ 10946, 6, "\342\212\237" }, /* minusb */
+	{ 5877, 4, "\342\251\234" }, /* andd */
+	{ 0, 0, "" },
+	{ 7421, 5, "\342\253\221" }, /* csube */
+	{ 11325, 3, "\342\211\261" }, /* nge */
+	{ 8557, 5, "\357\254\201" }, /* filig */
+	{ 3122, 15, "\342\211\216\314\270" }, /* NotHumpDownHump */
+	{ 12187, 4, "\342\250\270" }, /* odiv */
+	{ 11184, 5, "\342\211\216\314\270" }, /* nbump */
+	{ 0, 0, "" },
+	{ 12692, 5, "\342\211\274" }, /* prcue */
+	{ 14479, 8, "\342\252\266" }, /* succneqq */
+	{ 15784, 6, "\342\253\214\357\270\200" }, /* vsupnE */
+	{ 15871, 5, "\342\227\257" }, /* xcirc */
+	{ 1719, 9, "\342\211\217" }, /* HumpEqual */
+	{ 5606, 6, "\342\212\252" }, /* Vvdash */
+	{ 14907, 3, "\342\212\244" }, /* top */
+	{ 12164, 5, "\303\264" }, /* ocirc */
+	{ 0, 0, "" },
+	{ 8665, 6, "\342\205\224" }, /* frac23 */
+	{ 13821, 4, "\073" }, /* semi */
+	{ 0, 0, "" },
+	{ 6884, 6, "\302\246" }, /* brvbar */
+	{ 7375, 4, "\360\235\225\224" }, /* copf */
+	{ 8483, 11, "\342\204\260" }, /* expectation */
+	{ 14765, 6, "\342\214\225" }, /* telrec */
+	{ 0, 0, "" },
+	{ 3988, 13, "\342\252\257" }, /* PrecedesEqual */
+	{ 203, 6, "\304\206" }, /* Cacute */
+	{ 1233, 3, "\360\235\224\210" }, /* Efr */
+	{ 13951, 4, "\342\252\236" }, /* simg */
+	{ 1391, 17, "\342\227\274" }, /* FilledSmallSquare */
+	{ 6376, 15, "\342\226\275" }, /* bigtriangledown */
+	{ 12472, 5, "\342\253\275" }, /* parsl */
+	{ 1275, 20, "\342\226\253" }, /* EmptyVerySmallSquare */
+	{ 0, 0, "" },
+	{ 10881, 5, "\342\200\224" }, /* mdash */
+	{ 14930, 7, "\342\253\232" }, /* topfork */
+	{ 2703, 9, "\342\210\223" }, /* MinusPlus */
+	{ 4190, 20, "\342\245\257" }, /* ReverseUpEquilibrium */
+	{ 12456, 8, "\342\210\245" }, /* parallel */
+	{ 12634, 6, "\302\261" }, /* plusmn */
+	{ 12144, 2, "\342\223\210" }, /* oS */
+	{ 12056, 7, "\342\247\236" }, /* nvinfin */
+	{ 13616, 5, "\342\200\231" }, /* rsquo */
+	{ 850, 24, "\342\237\272" }, /* DoubleLongLeftRightArrow */
+	{ 8008, 16, "\342\207\202" }, /* downharpoonright */
+	{ 9013, 9, "\342\252\206" }, /* gtrapprox */
+	{ 11074, 3, "\342\211\252\342\203\222" }, /* nLt */
+	{ 10821, 3, "\342\206\246" }, /* map */
+	{ 13090, 7, "\342\245\264" }, /* rarrsim */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 15162, 4, "\342\207\221" }, /* uArr */
+	{ 8449, 4, "\342\211\202" }, /* esim */
+	{ 10493, 13, "\342\206\253" }, /* looparrowleft */
+	{ 5678, 5, "\305\266" }, /* Ycirc */
+	{ 6189, 9, "\342\213\215" }, /* backsimeq */
+	{ 0, 0, "" },
+	{ 14031, 4, "\342\210\243" }, /* smid */
+	{ 15502, 6, "\342\246\234" }, /* vangrt */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 4601, 4, "\342\204\233" }, /* Rscr */
+	{ 13729, 5, "\305\235" }, /* scirc */
+	{ 5882, 8, "\342\251\230" }, /* andslope */
+	{ 166, 3, "\360\235\224\205" }, /* Bfr */
+	{ 4560, 10, "\342\207\222" }, /* Rightarrow */
+	{ 6020, 5, "\303\205" }, /* angst */
+	{ 7399, 5, "\342\206\265" }, /* crarr */
+	{ 8956, 4, "\342\204\212" }, /* gscr */
+	{ 9156, 9, "\342\231\245" }, /* heartsuit */
+	{ 3511, 22, "\342\213\243" }, /* NotSquareSupersetEqual */
+	{ 5688, 3, "\360\235\224\234" }, /* Yfr */
+	{ 10089, 17, "\342\207\213" }, /* leftrightharpoons */
+	{ 12586, 4, "\053" }, /* plus */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 5086, 9, "\342\200\211" }, /* ThinSpace */
+	{ 12660, 8, "\342\250\225" }, /* pointint */
+	{ 8112, 8, "\342\237\277" }, /* dzigrarr */
+	{ 11723, 3, "\342\212\201" }, /* nsc */
+	{ 12985, 5, "\342\210\232" }, /* radic */
+	{ 11329, 4, "\342\211\261" }, /* ngeq */
+	{ 14950, 5, "\342\204\242" }, /* trade */
+	{ 0, 0, "" },
+	{ 10284, 2, "\342\211\266" }, /* lg */
+	{ 7022, 5, "\342\201\201" }, /* caret */
+	{ 10714, 6, "\342\213\211" }, /* ltimes */
+	{ 2795, 17, "\342\200\213" }, /* NegativeThinSpace */
+	{ 15806, 5, "\305\265" }, /* wcirc */
+	{ 6789, 7, "\342\212\236" }, /* boxplus */
+	{ 6566, 7, "\342\211\241\342\203\245" }, /* bnequiv */
+	{ 7112, 4, "\321\207" }, /* chcy */
+	{ 6643, 5, "\342\225\244" }, /* boxHd */
+	{ 3186, 20, "\342\213\254" }, /* NotLeftTriangleEqual */
+	{ 0, 0, "" },
+	{ 4999, 6, "\342\213\221" }, /* Supset */
+	{ 14437, 10, "\342\252\270" }, /* succapprox */
+	{ 9335, 2, "\342\205\210" }, /* ii */
+	{ 14265, 15, "\317\265" }, /* straightepsilon */
+	{ 8630, 6, "\342\205\223" }, /* frac13 */
+	{ 0, 0, "" },
+	{ 13712, 5, "\342\211\275" }, /* sccue */
+	{ 3738, 2, "\316\235" }, /* Nu */
+	{ 6063, 4, "\342\211\213" }, /* apid */
+	{ 5166, 6, "\303\232" }, /* Uacute */
+	{ 12210, 5, "\342\246\277" }, /* ofcir */
+	{ 11136, 5, "\342\211\213\314\270" }, /* napid */
+	{ 0, 0, "" },
+	{ 10377, 3, "\342\211\250" }, /* lnE */
+	{ 15935, 4, "\360\235\225\251" }, /* xopf */
+	{ 10629, 6, "\342\200\271" }, /* lsaquo */
+	{ 7258, 6, "\342\253\257" }, /* cirmid */
+	{ 0, 0, "" },
+	{ 1534, 16, "\342\213\233" }, /* GreaterEqualLess */
+	{ 7093, 4, "\302\242" }, /* cent */
+	{ 0, 0, "" },
+	{ 3741, 5, "\305\222" }, /* OElig */
+	{ 0, 0, "" },
+	{ 13735, 4, "\342\252\266" }, /* scnE */
+	{ 0, 0, "" },
+	{ 12973, 4, "\342\210\275\314\261" }, /* race */
+	{ 1994, 6, "\316\233" }, /* Lambda */
+	{ 9351, 6, "\342\247\234" }, /* iinfin */
+	{ 2040, 16, "\342\237\250" }, /* LeftAngleBracket */
+	{ 3052, 17, "\342\211\253\314\270" }, /* NotGreaterGreater */
+	{ 6392, 13, "\342\226\263" }, /* bigtriangleup */
+	{ 14488, 8, "\342\213\251" }, /* succnsim */
+	{ 10548, 6, "\342\210\227" }, /* lowast */
+	{ 14604, 5, "\342\212\213" }, /* supne */
+	{ 9779, 5, "\302\253" }, /* laquo */
+	{ 10623, 5, "\342\212\277" }, /* lrtri */
+	{ 10919, 6, "\052" }, /* midast */
+	{ 10877, 3, "\320\274" }, /* mcy */
+	{ 1048, 17, "\342\245\236" }, /* DownLeftTeeVector */
+	{ 2699, 3, "\360\235\224\220" }, /* Mfr */
+	{ 0, 0, "" },
+	{ 7532, 6, "\342\206\267" }, /* curarr */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 11653, 4, "\342\252\257\314\270" }, /* npre */
+	{ 0, 0, "" },
+	{ 5592, 3, "\360\235\224\231" }, /* Vfr */
+	{ 8910, 4, "\342\252\212" }, /* gnap */
+	{ 503, 5, "\342\250\257" }, /* Cross */
+	{ 11289, 6, "\342\244\250" }, /* nesear */
+	{ 1734, 5, "\304\262" }, /* IJlig */
+	{ 1258, 16, "\342\227\273" }, /* EmptySmallSquare */
+	{ 10029, 13, "\342\206\274" }, /* leftharpoonup */
+	{ 6847, 5, "\342\225\236" }, /* boxvR */
+	{ 0, 0, "" },
+	{ 15721, 4, "\174" }, /* vert */
+	{ 12687, 4, "\342\252\267" }, /* prap */
+	{ 12707, 10, "\342\252\267" }, /* precapprox */
+	{ 0, 0, "" },
+	{ 10150, 4, "\342\211\246" }, /* leqq */
+	{ 12564, 6, "\342\204\217" }, /* planck */
+	{ 7416, 4, "\342\253\217" }, /* csub */
+	{ 10181, 7, "\342\252\201" }, /* lesdoto */
+	{ 10533, 6, "\342\250\255" }, /* loplus */
+	{ 11499, 3, "\342\211\256" }, /* nlt */
+	{ 12621, 6, "\342\250\245" }, /* plusdu */
+	{ 6068, 4, "\047" }, /* apos */
+	{ 10887, 13, "\342\210\241" }, /* measuredangle */
+	{ 8679, 6, "\302\276" }, /* frac34 */
+	{ 9847, 3, "\342\252\253" }, /* lat */
+	{ 7613, 15, "\342\206\267" }, /* curvearrowright */
+	{ 15312, 7, "\342\206\221" }, /* uparrow */
+	{ 15843, 4, "\360\235\225\250" }, /* wopf */
+	{ 0, 0, "" },
+	{ 10146, 3, "\342\211\244" }, /* leq */
+	{ 14911, 6, "\342\214\266" }, /* topbot */
+	{ 10058, 14, "\342\206\224" }, /* leftrightarrow */
+	{ 13140, 5, "\342\235\263" }, /* rbbrk */
+	{ 13530, 5, "\342\207\276" }, /* roarr */
+	{ 8403, 5, "\342\211\241" }, /* equiv */
+	{ 7315, 6, "\100" }, /* commat */
+	{ 15904, 2, "\316\276" }, /* xi */
+	{ 11900, 9, "\342\212\211" }, /* nsupseteq */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 4295, 18, "\342\237\247" }, /* RightDoubleBracket */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 15832, 6, "\342\204\230" }, /* weierp */
+	{ 15575, 8, "\317\202" }, /* varsigma */
+	{ 711, 3, "\302\250" }, /* Dot */
+	{ 1459, 4, "\320\203" }, /* GJcy */
+	{ 4107, 3, "\302\256" }, /* REG */
+	{ 4467, 17, "\342\245\217" }, /* RightUpDownVector */
+	{ 12251, 5, "\342\206\272" }, /* olarr */
+	{ 9618, 4, "\360\235\222\277" }, /* jscr */
+	{ 10359, 6, "\342\216\260" }, /* lmoust */
+	{ 9202, 5, "\342\207\277" }, /* hoarr */
+	{ 0, 0, "" },
+	{ 3228, 14, "\342\211\270" }, /* NotLessGreater */
+	{ 0, 0, "" },
+	{ 1321, 10, "\342\211\202" }, /* EqualTilde */
+	{ 0, 0, "" },
+	{ 10597, 8, "\342\214\237" }, /* lrcorner */
+	{ 9775, 3, "\342\252\205" }, /* lap */
+	{ 5996, 7, "\342\212\276" }, /* angrtvb */
+	{ 8966, 5, "\342\252\216" }, /* gsime */
+	{ 10584, 6, "\342\246\223" }, /* lparlt */
+	{ 0, 0, "" },
+	{ 2518, 13, "\342\237\265" }, /* LongLeftArrow */
+	{ 11388, 2, "\342\210\213" }, /* ni */
+	{ 7137, 3, "\342\227\213" }, /* cir */
+	{ 15233, 3, "\360\235\224\262" }, /* ufr */
+	{ 5870, 6, "\342\251\225" }, /* andand */
+	{ 0, 0, "" },
+	{ 7829, 7, "\317\235" }, /* digamma */
+	{ 10798, 4, "\302\257" }, /* macr */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 12483, 3, "\320\277" }, /* pcy */
+	{ 15547, 5, "\317\226" }, /* varpi */
+	{ 4101, 5, "\342\244\220" }, /* RBarr */
+	{ 0, 0, "" },
+	{ 5629, 4, "\360\235\225\216" }, /* Wopf */
+	{ 2745, 6, "\305\205" }, /* Ncedil */
+	{ 13230, 6, "\342\200\235" }, /* rdquor */
+	{ 0, 0, "" },
+	{ 4002, 18, "\342\211\274" }, /* PrecedesSlantEqual */
+	{ 9757, 4, "\342\237\250" }, /* lang */
+	{ 11404, 4, "\321\232" }, /* njcy */
+	{ 5759, 4, "\342\204\244" }, /* Zopf */
+	{ 13622, 6, "\342\200\231" }, /* rsquor */
+	{ 1979, 4, "\320\211" }, /* LJcy */
+	{ 12978, 6, "\305\225" }, /* racute */
+	{ 13466, 4, "\313\232" }, /* ring */
+	{ 12508, 4, "\342\212\245" }, /* perp */
+	{ 10303, 6, "\342\245\252" }, /* lharul */
+	{ 7047, 6, "\303\247" }, /* ccedil */
+	{ 13967, 5, "\342\252\237" }, /* simlE */
+	{ 13316, 3, "\317\201" }, /* rho */
+	{ 10297, 5, "\342\206\274" }, /* lharu */
+	{ 9743, 6, "\342\204\222" }, /* lagran */
+	{ 12420, 6, "\342\212\227" }, /* otimes */
+	{ 14518, 4, "\302\271" }, /* sup1 */
+	{ 0, 0, "" },
+	{ 6267, 7, "\342\246\260" }, /* bemptyv */
+	{ 0, 0, "" },
+	{ 11030, 3, "\342\213\231\314\270" }, /* nGg */
+	{ 0, 0, "" },
+	{ 14146, 8, "\342\212\217" }, /* sqsubset */
+	{ 1778, 2, "\342\204\221" }, /* Im */
+	{ 7942, 9, "\342\212\241" }, /* dotsquare */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 13995, 5, "\342\206\220" }, /* slarr */
+	{ 0, 0, "" },
+	{ 3005, 10, "\342\211\257" }, /* NotGreater */
+	{ 4571, 4, "\342\204\235" }, /* Ropf */
+	{ 10673, 6, "\342\200\232" }, /* lsquor */
+	{ 13568, 4, "\051" }, /* rpar */
+	{ 10953, 6, "\342\210\270" }, /* minusd */
+	{ 15461, 5, "\342\207\210" }, /* uuarr */
+	{ 0, 0, "" },
+	{ 12868, 3, "\317\210" }, /* psi */
+	{ 0, 0, "" },
+	{ 12550, 9, "\342\213\224" }, /* pitchfork */
+	{ 11391, 3, "\342\213\274" }, /* nis */
+	{ 988, 12, "\342\244\223" }, /* DownArrowBar */
+	{ 10707, 6, "\342\213\213" }, /* lthree */
+	{ 11190, 6, "\342\211\217\314\270" }, /* nbumpe */
+	{ 13929, 3, "\342\210\274" }, /* sim */
+	{ 10777, 9, "\342\211\250\357\270\200" }, /* lvertneqq */
+	{ 0, 0, "" },
+	{ 6080, 8, "\342\211\212" }, /* approxeq */
+	{ 0, 0, "" },
+	{ 8823, 3, "\342\251\276" }, /* ges */
+	{ 15067, 7, "\342\250\271" }, /* triplus */
+	{ 10760, 8, "\342\245\212" }, /* lurdshar */
+	{ 5656, 4, "\320\257" }, /* YAcy */
+	{ 14308, 6, "\342\252\275" }, /* subdot */
+	{ 13573, 6, "\342\246\224" }, /* rpargt */
+	{ 3872, 4, "\303\226" }, /* Ouml */
+	{ 4610, 11, "\342\247\264" }, /* RuleDelayed */
+	{ 2726, 4, "\320\212" }, /* NJcy */
+	{ 9487, 7, "\342\250\274" }, /* intprod */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 8396, 6, "\342\211\237" }, /* equest */
+	{ 15307, 4, "\360\235\225\246" }, /* uopf */
+	{ 8139, 6, "\342\251\256" }, /* easter */
+	{ 9888, 6, "\133" }, /* lbrack */
+	{ 7174, 16, "\342\206\273" }, /* circlearrowright */
+	{ 0, 0, "" },
+	{ 13973, 5, "\342\211\206" }, /* simne */
+	{ 14514, 3, "\342\212\203" }, /* sup */
+	{ 15437, 5, "\342\213\260" }, /* utdot */
+	{ 72, 13, "\342\201\241" }, /* ApplyFunction */
+	{ 13303, 5, "\342\207\200" }, /* rharu */
+	{ 0, 0, "" },
+	{ 10467, 10, "\342\237\274" }, /* longmapsto */
+	{ 9256, 4, "\360\235\222\275" }, /* hscr */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 335, 11, "\342\212\227" }, /* CircleTimes */
+	{ 8158, 5, "\303\252" }, /* ecirc */
+	{ 10787, 4, "\342\211\250\357\270\200" }, /* lvnE */
+	{ 15472, 7, "\342\246\247" }, /* uwangle */
+	{ 6118, 6, "\303\243" }, /* atilde */
+	{ 8048, 4, "\360\235\222\271" }, /* dscr */
+	{ 13933, 6, "\342\251\252" }, /* simdot */
+	{ 0, 0, "" },
+	{ 2036, 3, "\320\233" }, /* Lcy */
+	{ 552, 6, "\342\200\241" }, /* Dagger */
+	{ 0, 0, "" },
+	{ 3379, 17, "\342\210\214" }, /* NotReverseElement */
+	{ 10316, 4, "\321\231" }, /* ljcy */
+	{ 8121, 5, "\342\251\267" }, /* eDDot */
+	{ 9500, 5, "\304\257" }, /* iogon */
+	{ 14528, 4, "\302\263" }, /* sup3 */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 14679, 6, "\342\253\226" }, /* supsup */
+	{ 6310, 6, "\342\213\202" }, /* bigcap */
+	{ 8522, 3, "\321\204" }, /* fcy */
+	{ 10127, 14, "\342\213\213" }, /* leftthreetimes */
+	{ 0, 0, "" },
+	{ 8193, 2, "\342\252\232" }, /* eg */
+	{ 3782, 5, "\305\214" }, /* Omacr */
+	{ 3802, 4, "\360\235\225\206" }, /* Oopf */
+	{ 250, 6, "\303\207" }, /* Ccedil */
+	{ 13905, 3, "\302\255" }, /* shy */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 7894, 6, "\044" }, /* dollar */
+	{ 6045, 2, "\342\211\210" }, /* ap */
+	{ 13286, 6, "\342\214\213" }, /* rfloor */
+	{ 9382, 8, "\342\204\220" }, /* imagline */
+	{ 11892, 7, "\342\212\203\342\203\222" }, /* nsupset */
+	{ 0, 0, "" },
+	{ 1028, 19, "\342\245\220" }, /* DownLeftRightVector */
+	{ 0, 0, "" },
+	{ 6463, 13, "\342\226\264" }, /* blacktriangle */
+	{ 8637, 6, "\302\274" }, /* frac14 */
+	{ 16038, 4, "\360\235\225\252" }, /* yopf */
+	{ 8093, 5, "\342\245\257" }, /* duhar */
+	{ 11678, 5, "\342\206\233" }, /* nrarr */
+	{ 0, 0, "" },
+	{ 6588, 6, "\342\212\245" }, /* bottom */
+	{ 45, 5, "\316\221" }, /* Alpha */
+	{ 14610, 7, "\342\253\200" }, /* supplus */
+	{ 0, 0, "" },
+	{ 7411, 4, "\360\235\222\270" }, /* cscr */
+	{ 14558, 7, "\342\253\204" }, /* supedot */
+	{ 14051, 5, "\342\252\254\357\270\200" }, /* smtes */
+	{ 3328, 11, "\342\212\200" }, /* NotPrecedes */
+	{ 14364, 6, "\342\212\202" }, /* subset */
+	{ 15568, 6, "\317\261" }, /* varrho */
+	{ 0, 0, "" },
+	{ 5625, 3, "\360\235\224\232" }, /* Wfr */
+	{ 4502, 13, "\342\206\276" }, /* RightUpVector */
+	{ 5769, 6, "\303\241" }, /* aacute */
+	{ 8041, 6, "\342\214\214" }, /* drcrop */
+	{ 0, 0, "" },
+	{ 11921, 4, "\342\211\271" }, /* ntgl */
+	{ 11434, 10, "\342\206\232" }, /* nleftarrow */
+	{ 14776, 6, "\342\210\264" }, /* there4 */
+	{ 0, 0, "" },
+	{ 7220, 11, "\342\212\232" }, /* circledcirc */
+	{ 7380, 6, "\342\210\220" }, /* coprod */
+	{ 8902, 3, "\342\252\244" }, /* glj */
+	{ 14815, 11, "\342\211\210" }, /* thickapprox */
+	{ 13654, 5, "\342\226\270" }, /* rtrif */
+	{ 10366, 10, "\342\216\260" }, /* lmoustache */
+	{ 5446, 7, "\316\245" }, /* Upsilon */
+	{ 9734, 8, "\342\246\264" }, /* laemptyv */
+	{ 7360, 7, "\342\251\255" }, /* congdot */
+	{ 0, 0, "" },
+	{ 10210, 10, "\342\252\205" }, /* lessapprox */
+	{ 0, 0, "" },
+	{ 10330, 8, "\342\214\236" }, /* llcorner */
+	{ 5472, 4, "\303\234" }, /* Uuml */
+	{ 0, 0, "" },
+	{ 6708, 5, "\342\225\242" }, /* boxVl */
+	{ 0, 0, "" },
+	{ 15386, 10, "\342\207\210" }, /* upuparrows */
+	{ 7794, 4, "\342\213\204" }, /* diam */
+	{ 7739, 5, "\342\207\212" }, /* ddarr */
+	{ 12781, 6, "\342\204\231" }, /* primes */
+	{ 16025, 3, "\302\245" }, /* yen */
+	{ 11321, 3, "\342\211\247\314\270" }, /* ngE */
+	{ 5200, 5, "\303\233" }, /* Ucirc */
+	{ 4912, 13, "\342\252\260" }, /* SucceedsEqual */
+	{ 14068, 4, "\342\247\204" }, /* solb */
+	{ 8467, 4, "\342\202\254" }, /* euro */
+	{ 2366, 10, "\342\206\274" }, /* LeftVector */
+	{ 12863, 4, "\360\235\223\205" }, /* pscr */
+	{ 8759, 5, "\316\263" }, /* gamma */
+	{ 14890, 6, "\342\250\260" }, /* timesd */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 612, 14, "\313\231" }, /* DiacriticalDot */
+	{ 10321, 2, "\342\211\252" }, /* ll */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 7635, 5, "\342\213\217" }, /* cuwed */
+	{ 8076, 4, "\342\226\277" }, /* dtri */
+	{ 5359, 13, "\342\245\256" }, /* UpEquilibrium */
+	{ 13076, 6, "\342\206\254" }, /* rarrlp */
+	{ 4679, 14, "\342\206\223" }, /* ShortDownArrow */
+	{ 9406, 4, "\342\212\267" }, /* imof */
+	{ 7910, 5, "\342\211\220" }, /* doteq */
+	{ 7108, 3, "\360\235\224\240" }, /* cfr */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 7444, 7, "\342\244\270" }, /* cudarrl */
+	{ 12758, 8, "\342\213\250" }, /* precnsim */
+	{ 8409, 7, "\342\251\270" }, /* equivDD */
+	{ 15753, 5, "\342\210\235" }, /* vprop */
+	{ 14827, 8, "\342\210\274" }, /* thicksim */
+	{ 9522, 6, "\302\277" }, /* iquest */
+	{ 9851, 6, "\342\244\231" }, /* latail */
+	{ 0, 0, "" },
+	{ 111, 4, "\303\204" }, /* Auml */
+	{ 9364, 5, "\304\263" }, /* ijlig */
+	{ 0, 0, "" },
+	{ 5425, 15, "\342\206\227" }, /* UpperRightArrow */
+	{ 1758, 3, "\320\230" }, /* Icy */
+	{ 14139, 6, "\342\212\221" }, /* sqsube */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 15540, 6, "\317\225" }, /* varphi */
+	{ 5810, 5, "\303\246" }, /* aelig */
+	{ 6139, 5, "\342\250\221" }, /* awint */
+	{ 8053, 4, "\321\225" }, /* dscy */
+	{ 15378, 7, "\317\205" }, /* upsilon */
+	{ 14022, 8, "\342\247\244" }, /* smeparsl */
+	{ 8898, 3, "\342\252\245" }, /* gla */
+	{ 34, 3, "\360\235\224\204" }, /* Afr */
+	{ 0, 0, "" },
+	{ 10680, 6, "\305\202" }, /* lstrok */
+	{ 6649, 5, "\342\225\247" }, /* boxHu */
+	{ 0, 0, "" },
+	{ 11370, 5, "\342\207\216" }, /* nhArr */
+	{ 11302, 6, "\342\210\204" }, /* nexist */
+	{ 2286, 17, "\342\212\264" }, /* LeftTriangleEqual */
+	{ 0, 0, "" },
+	{ 13746, 6, "\342\213\251" }, /* scnsim */
+	{ 11197, 4, "\342\251\203" }, /* ncap */
+	{ 186, 6, "\342\211\216" }, /* Bumpeq */
+	{ 11727, 6, "\342\213\241" }, /* nsccue */
+	{ 6574, 4, "\342\214\220" }, /* bnot */
+	{ 13548, 4, "\360\235\225\243" }, /* ropf */
+	{ 13753, 8, "\342\250\223" }, /* scpolint */
+	{ 16065, 6, "\305\276" }, /* zcaron */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 11560, 7, "\342\213\267" }, /* notinvb */
+	{ 11672, 5, "\342\207\217" }, /* nrArr */
+	{ 14897, 4, "\342\210\255" }, /* tint */
+	{ 10522, 5, "\342\246\205" }, /* lopar */
+	{ 1494, 5, "\304\234" }, /* Gcirc */
+	{ 4060, 12, "\342\210\235" }, /* Proportional */
+	{ 3544, 14, "\342\212\210" }, /* NotSubsetEqual */
+	{ 0, 0, "" },
+	{ 13722, 6, "\305\237" }, /* scedil */
+	{ 11734, 4, "\342\252\260\314\270" }, /* nsce */
+	{ 0, 0, "" },
+	{ 13471, 12, "\342\211\223" }, /* risingdotseq */
+	{ 5173, 4, "\342\206\237" }, /* Uarr */
+	{ 0, 0, "" },
+	{ 9727, 6, "\304\272" }, /* lacute */
+	{ 13643, 4, "\342\226\271" }, /* rtri */
+	{ 7901, 4, "\360\235\225\225" }, /* dopf */
+	{ 10239, 10, "\342\252\213" }, /* lesseqqgtr */
+	{ 7580, 10, "\342\213\217" }, /* curlywedge */
+	{ 15291, 5, "\305\253" }, /* umacr */
+	{ 1767, 3, "\342\204\221" }, /* Ifr */
+	{ 13134, 5, "\342\244\215" }, /* rbarr */
+	{ 13740, 5, "\342\252\272" }, /* scnap */
+	{ 0, 0, "" },
+	{ 13940, 4, "\342\211\203" }, /* sime */
+	{ 8443, 5, "\342\211\220" }, /* esdot */
+	{ 6673, 5, "\342\225\231" }, /* boxUr */
+	{ 595, 16, "\302\264" }, /* DiacriticalAcute */
+	{ 0, 0, "" },
+	{ 14371, 8, "\342\212\206" }, /* subseteq */
+	{ 1847, 14, "\342\201\242" }, /* InvisibleTimes */
+	{ 4485, 16, "\342\245\234" }, /* RightUpTeeVector */
+	{ 0, 0, "" },
+	{ 11115, 6, "\305\204" }, /* nacute */
+	{ 11340, 9, "\342\251\276\314\270" }, /* ngeqslant */
+	{ 5634, 4, "\360\235\222\262" }, /* Wscr */
+	{ 11634, 7, "\342\250\224" }, /* npolint */
+	{ 0, 0, "" },
+	{ 528, 8, "\342\244\221" }, /* DDotrahd */
+	{ 10189, 8, "\342\252\203" }, /* lesdotor */
+	{ 1118, 15, "\342\207\201" }, /* DownRightVector */
+	{ 12220, 4, "\313\233" }, /* ogon */
+	{ 10863, 6, "\342\226\256" }, /* marker */
+	{ 15996, 6, "\342\213\200" }, /* xwedge */
+	{ 4903, 8, "\342\211\273" }, /* Succeeds */
+	{ 15269, 8, "\342\214\234" }, /* ulcorner */
+	{ 0, 0, "" },
+	{ 9030, 6, "\342\213\227" }, /* gtrdot */
+	{ 15496, 5, "\342\212\250" }, /* vDash */
+	{ 518, 6, "\342\211\215" }, /* CupCap */
+	{ 0, 0, "" },
+	{ 13693, 2, "\342\211\273" }, /* sc */
+	{ 0, 0, "" },
+	{ 13687, 5, "\342\200\232" }, /* sbquo */
+	{ 0, 0, "" },
+	{ 10291, 5, "\342\206\275" }, /* lhard */
+	{ 5661, 4, "\320\207" }, /* YIcy */
+	{ 0, 0, "" },
+	{ 1781, 5, "\304\252" }, /* Imacr */
+	{ 1943, 4, "\320\214" }, /* KJcy */
+	{ 0, 0, "" },
+	{ 13553, 6, "\342\250\256" }, /* roplus */
+	{ 0, 0, "" },
+	{ 10221, 7, "\342\213\226" }, /* lessdot */
+	{ 1901, 5, "\304\264" }, /* Jcirc */
+	{ 6125, 4, "\303\244" }, /* auml */
+	{ 0, 0, "" },
+	{ 3207, 7, "\342\211\256" }, /* NotLess */
+	{ 14978, 12, "\342\227\203" }, /* triangleleft */
+	{ 13915, 6, "\317\202" }, /* sigmaf */
+	{ 13017, 6, "\342\237\251" }, /* rangle */
+	{ 0, 0, "" },
+	{ 11516, 4, "\342\210\244" }, /* nmid */
+	{ 6, 3, "\046" }, /* AMP */
+	{ 3843, 2, "\342\251\224" }, /* Or */
+	{ 0, 0, "" },
+	{ 14553, 4, "\342\212\207" }, /* supe */
+	{ 15624, 13, "\342\253\214\357\270\200" }, /* varsupsetneqq */
+	{ 5702, 4, "\305\270" }, /* Yuml */
+	{ 12396, 4, "\342\204\264" }, /* oscr */
+	{ 12427, 8, "\342\250\266" }, /* otimesas */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 12799, 6, "\342\213\250" }, /* prnsim */
+	{ 1383, 3, "\320\244" }, /* Fcy */
+	{ 13922, 6, "\317\202" }, /* sigmav */
+	{ 12788, 4, "\342\252\265" }, /* prnE */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 2493, 3, "\360\235\224\217" }, /* Lfr */
+	{ 14356, 7, "\342\245\271" }, /* subrarr */
+	{ 0, 0, "" },
+	{ 4379, 8, "\342\212\242" }, /* RightTee */
+	{ 9964, 7, "\342\245\247" }, /* ldrdhar */
+	{ 0, 0, "" },
+	{ 11598, 7, "\342\213\275" }, /* notnivc */
+	{ 0, 0, "" },
+	{ 8253, 8, "\342\210\205" }, /* emptyset */
+	{ 9863, 5, "\342\252\255\357\270\200" }, /* lates */
+	{ 15960, 5, "\342\237\266" }, /* xrarr */
+	{ 10743, 4, "\342\227\203" }, /* ltri */
+	{ 1521, 12, "\342\211\245" }, /* GreaterEqual */
+	{ 0, 0, "" },
+	{ 6702, 5, "\342\225\253" }, /* boxVh */
+	{ 12277, 3, "\342\247\200" }, /* olt */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 14756, 3, "\321\202" }, /* tcy */
+	{ 15971, 6, "\342\250\206" }, /* xsqcup */
+	{ 11774, 5, "\342\211\204" }, /* nsime */
+	{ 13789, 5, "\342\207\230" }, /* seArr */
+	{ 6812, 5, "\342\225\230" }, /* boxuR */
+	{ 0, 0, "" },
+	{ 13496, 3, "\342\200\217" }, /* rlm */
+	{ 4545, 14, "\342\245\223" }, /* RightVectorBar */
+	{ 1349, 4, "\342\251\263" }, /* Esim */
+	{ 3971, 4, "\342\204\231" }, /* Popf */
+	{ 6818, 5, "\342\224\230" }, /* boxul */
+	{ 0, 0, "" },
+	{ 2972, 8, "\342\211\240" }, /* NotEqual */
+	{ 5330, 16, "\342\207\205" }, /* UpArrowDownArrow */
+	{ 16072, 3, "\320\267" }, /* zcy */
+	{ 0, 0, "" },
+	{ 8495, 12, "\342\205\207" }, /* exponentiale */
+	{ 10258, 7, "\342\211\262" }, /* lesssim */
+	{ 3846, 4, "\360\235\222\252" }, /* Oscr */
+	{ 0, 0, "" },
+	{ 16003, 6, "\303\275" }, /* yacute */
+	{ 0, 0, "" },
+	{ 6213, 8, "\342\214\205" }, /* barwedge */
+	{ 12749, 8, "\342\252\265" }, /* precneqq */
+	{ 12718, 11, "\342\211\274" }, /* preccurlyeq */
+	{ 0, 0, "" },
+	{ 15108, 5, "\321\233" }, /* tshcy */
+	{ 6199, 6, "\342\212\275" }, /* barvee */
+	{ 1454, 4, "\342\204\261" }, /* Fscr */
+	{ 2619, 14, "\342\206\231" }, /* LowerLeftArrow */
+	{ 3138, 12, "\342\211\217\314\270" }, /* NotHumpEqual */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 10905, 3, "\342\204\247" }, /* mho */
+	{ 0, 0, "" },
+	{ 3032, 19, "\342\211\247\314\270" }, /* NotGreaterFullEqual */
+	{ 2689, 9, "\342\204\263" }, /* Mellintrf */
+	{ 15485, 4, "\342\253\250" }, /* vBar */
+	{ 11576, 5, "\342\210\214" }, /* notni */
+	{ 816, 13, "\342\253\244" }, /* DoubleLeftTee */
+	{ 11231, 4, "\342\251\202" }, /* ncup */
+	{ 0, 0, "" },
+	{ 13802, 5, "\342\206\230" }, /* searr */
+	{ 779, 15, "\342\207\220" }, /* DoubleLeftArrow */
+	{ 0, 0, "" },
+	{ 15190, 6, "\305\255" }, /* ubreve */
+	{ 13069, 6, "\342\206\252" }, /* rarrhk */
+	{ 11419, 5, "\342\206\232" }, /* nlarr */
+	{ 14107, 5, "\342\212\223" }, /* sqcap */
+	{ 0, 0, "" },
+	{ 7507, 6, "\342\251\212" }, /* cupcup */
+	{ 5492, 5, "\342\212\251" }, /* Vdash */
+	{ 12293, 7, "\316\277" }, /* omicron */
+	{ 6246, 5, "\342\200\236" }, /* bdquo */
+	{ 1954, 6, "\304\266" }, /* Kcedil */
+	{ 11521, 4, "\360\235\225\237" }, /* nopf */
+	{ 12541, 5, "\342\230\216" }, /* phone */
+	{ 1657, 3, "\342\204\214" }, /* Hfr */
+	{ 14467, 11, "\342\252\272" }, /* succnapprox */
+	{ 12263, 7, "\342\246\273" }, /* olcross */
+	{ 0, 0, "" },
+	{ 11461, 4, "\342\211\260" }, /* nleq */
+	{ 0, 0, "" },
+	{ 13011, 5, "\342\246\245" }, /* range */
+	{ 11536, 6, "\342\213\271\314\270" }, /* notinE */
+	{ 3493, 17, "\342\212\220\314\270" }, /* NotSquareSuperset */
+	{ 11276, 5, "\342\211\220\314\270" }, /* nedot */
+	{ 9391, 8, "\342\204\221" }, /* imagpart */
+	{ 0, 0, "" },
+	{ 6145, 4, "\342\253\255" }, /* bNot */
+	{ 6171, 9, "\342\200\265" }, /* backprime */
+	{ 2995, 9, "\342\210\204" }, /* NotExists */
+	{ 5154, 4, "\360\235\222\257" }, /* Tscr */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 7771, 6, "\342\245\277" }, /* dfisht */
+	{ 12401, 6, "\303\270" }, /* oslash */
+	{ 15611, 12, "\342\212\213\357\270\200" }, /* varsupsetneq */
+	{ 7117, 5, "\342\234\223" }, /* check */
+	{ 13189, 6, "\305\227" }, /* rcedil */
+	{ 8320, 5, "\342\251\261" }, /* eplus */
+	{ 6996, 6, "\342\251\213" }, /* capcap */
+	{ 0, 0, "" },
+	{ 9143, 5, "\304\245" }, /* hcirc */
+	{ 4211, 3, "\342\204\234" }, /* Rfr */
+	{ 7559, 11, "\342\213\237" }, /* curlyeqsucc */
+	{ 7010, 6, "\342\251\200" }, /* capdot */
+	{ 12329, 5, "\342\212\225" }, /* oplus */
+	{ 15924, 4, "\342\213\273" }, /* xnis */
+	{ 0, 0, "" },
+	{ 2416, 16, "\342\213\232" }, /* LessEqualGreater */
+	{ 6317, 7, "\342\227\257" }, /* bigcirc */
+	{ 11148, 7, "\342\211\211" }, /* napprox */
+	{ 9449, 3, "\342\210\253" }, /* int */
+	{ 10, 6, "\303\201" }, /* Aacute */
+	{ 7778, 3, "\360\235\224\241" }, /* dfr */
+	{ 6679, 4, "\342\225\221" }, /* boxV */
+	{ 16102, 7, "\342\207\235" }, /* zigrarr */
+	{ 6222, 4, "\342\216\265" }, /* bbrk */
+	{ 0, 0, "" },
+	{ 5498, 6, "\342\253\246" }, /* Vdashl */
+	{ 8891, 2, "\342\211\267" }, /* gl */
+	{ 12487, 6, "\045" }, /* percnt */
+	{ 15954, 5, "\342\237\271" }, /* xrArr */
+	{ 11840, 9, "\342\212\210" }, /* nsubseteq */
+	{ 5029, 3, "\011" }, /* Tab */
+	{ 13270, 4, "\342\226\255" }, /* rect */
+	{ 10395, 3, "\342\252\207" }, /* lne */
+	{ 0, 0, "" },
+	{ 11664, 7, "\342\252\257\314\270" }, /* npreceq */
+	{ 0, 0, "" },
+	{ 3656, 8, "\342\211\201" }, /* NotTilde */
+	{ 14699, 5, "\342\206\231" }, /* swarr */
+	{ 9796, 7, "\342\244\237" }, /* larrbfs */
+	{ 9697, 4, "\342\207\220" }, /* lArr */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 9296, 2, "\342\201\243" }, /* ic */
+	{ 8765, 6, "\317\235" }, /* gammad */
+	{ 15839, 3, "\360\235\224\264" }, /* wfr */
+	{ 8454, 3, "\316\267" }, /* eta */
+	{ 0, 0, "" },
+	{ 11005, 6, "\342\210\276" }, /* mstpos */
+	{ 7763, 7, "\342\246\261" }, /* demptyv */
+	{ 235, 7, "\342\204\255" }, /* Cayleys */
+	{ 8175, 4, "\304\227" }, /* edot */
+	{ 0, 0, "" },
+	{ 13870, 6, "\321\211" }, /* shchcy */
+	{ 10346, 5, "\342\227\272" }, /* lltri */
+	{ 15947, 6, "\342\250\202" }, /* xotime */
+	{ 8752, 6, "\307\265" }, /* gacute */
+	{ 9088, 4, "\342\207\224" }, /* hArr */
+	{ 13048, 7, "\342\244\240" }, /* rarrbfs */
+	{ 302, 9, "\342\212\231" }, /* CircleDot */
+	{ 0, 0, "" },
+	{ 8894, 3, "\342\252\222" }, /* glE */
+	{ 0, 0, "" },
+	{ 14545, 7, "\342\253\230" }, /* supdsub */
+	{ 13636, 6, "\342\213\212" }, /* rtimes */
+	{ 6595, 6, "\342\213\210" }, /* bowtie */
+	{ 12521, 3, "\360\235\224\255" }, /* pfr */
+	{ 5254, 12, "\342\216\265" }, /* UnderBracket */
+	{ 4880, 3, "\342\213\220" }, /* Sub */
+	{ 9656, 3, "\320\272" }, /* kcy */
+	{ 15121, 5, "\342\211\254" }, /* twixt */
+	{ 6614, 5, "\342\225\226" }, /* boxDl */
+	{ 150, 10, "\342\204\254" }, /* Bernoullis */
+	{ 0, 0, "" },
+	{ 2029, 6, "\304\273" }, /* Lcedil */
+	{ 298, 3, "\316\247" }, /* Chi */
+	{ 9718, 3, "\342\252\213" }, /* lEg */
+	{ 1647, 3, "\136" }, /* Hat */
+	{ 8366, 10, "\342\252\226" }, /* eqslantgtr */
+	{ 0, 0, "" },
+	{ 13853, 3, "\360\235\224\260" }, /* sfr */
+	{ 14686, 5, "\342\207\231" }, /* swArr */
+	{ 7788, 5, "\342\207\202" }, /* dharr */
+	{ 7875, 4, "\321\222" }, /* djcy */
+	{ 13484, 5, "\342\207\204" }, /* rlarr */
+	{ 15220, 5, "\342\245\256" }, /* udhar */
+	{ 0, 0, "" },
+	{ 3070, 14, "\342\211\271" }, /* NotGreaterLess */
+	{ 1467, 5, "\316\223" }, /* Gamma */
+	{ 14073, 6, "\342\214\277" }, /* solbar */
+	{ 5786, 3, "\342\210\276\314\263" }, /* acE */
+	{ 5755, 3, "\342\204\250" }, /* Zfr */
+	{ 10926, 6, "\342\253\260" }, /* midcir */
+	{ 0, 0, "" },
+	{ 11012, 2, "\316\274" }, /* mu */
+	{ 0, 0, "" },
+	{ 4215, 3, "\316\241" }, /* Rho */
+	{ 7301, 7, "\342\211\224" }, /* coloneq */
+	{ 1915, 4, "\360\235\225\201" }, /* Jopf */
+	{ 9750, 6, "\316\273" }, /* lambda */
+	{ 0, 0, "" },
+	{ 5505, 3, "\342\213\201" }, /* Vee */
+	{ 2669, 3, "\342\244\205" }, /* Map */
+	{ 0, 0, "" },
+	{ 9986, 2, "\342\211\244" }, /* le */
+	{ 11034, 3, "\342\211\253\342\203\222" }, /* nGt */
+	{ 0, 0, "" },
+	{ 5390, 7, "\342\207\221" }, /* Uparrow */
+	{ 0, 0, "" },
+	{ 12806, 4, "\342\210\217" }, /* prod */
+	{ 8063, 6, "\304\221" }, /* dstrok */
+	{ 9588, 4, "\303\257" }, /* iuml */
+	{ 6040, 4, "\360\235\225\222" }, /* aopf */
+	{ 0, 0, "" },
+	{ 12089, 6, "\342\244\203" }, /* nvrArr */
+	{ 8180, 2, "\342\205\207" }, /* ee */
+	{ 3456, 15, "\342\212\217\314\270" }, /* NotSquareSubset */
+	{ 7934, 7, "\342\210\224" }, /* dotplus */
+	{ 8924, 3, "\342\252\210" }, /* gne */
+	{ 9553, 5, "\342\213\264" }, /* isins */
+	{ 13309, 6, "\342\245\254" }, /* rharul */
+	{ 7387, 4, "\302\251" }, /* copy */
+	{ 5945, 8, "\342\246\253" }, /* angmsdad */
+	{ 9534, 4, "\342\210\210" }, /* isin */
+	{ 0, 0, "" },
+	{ 6325, 6, "\342\213\203" }, /* bigcup */
+	{ 5750, 4, "\316\226" }, /* Zeta */
+	{ 11744, 9, "\342\210\244" }, /* nshortmid */
+	{ 0, 0, "" },
+	{ 6835, 5, "\342\225\252" }, /* boxvH */
+	{ 8793, 4, "\304\241" }, /* gdot */
+	{ 16120, 3, "\342\200\215" }, /* zwj */
+	{ 0, 0, "" },
+	{ 9599, 3, "\320\271" }, /* jcy */
+	{ 15907, 5, "\342\237\270" }, /* xlArr */
+	{ 12674, 5, "\302\243" }, /* pound */
+	{ 13166, 7, "\342\246\216" }, /* rbrksld */
+	{ 12116, 6, "\342\244\243" }, /* nwarhk */
+	{ 1204, 6, "\303\211" }, /* Eacute */
+	{ 4875, 4, "\342\213\206" }, /* Star */
+	{ 3895, 11, "\342\216\264" }, /* OverBracket */
+	{ 1436, 6, "\342\210\200" }, /* ForAll */
+	{ 0, 0, "" },
+	{ 2459, 8, "\342\252\241" }, /* LessLess */
+	{ 2856, 14, "\342\211\252" }, /* NestedLessLess */
+	{ 11880, 5, "\342\253\206\314\270" }, /* nsupE */
+	{ 15237, 6, "\303\271" }, /* ugrave */
+	{ 11487, 5, "\342\211\256" }, /* nless */
+	{ 7825, 3, "\302\250" }, /* die */
+	{ 10555, 6, "\137" }, /* lowbar */
+	{ 12242, 3, "\316\251" }, /* ohm */
+	{ 11552, 7, "\342\210\211" }, /* notinva */
+	{ 0, 0, "" },
+	{ 4087, 3, "\360\235\224\224" }, /* Qfr */
+	{ 13677, 2, "\342\204\236" }, /* rx */
+	{ 2337, 12, "\342\206\277" }, /* LeftUpVector */
+	{ 7692, 4, "\342\200\220" }, /* dash */
+	{ 86, 5, "\303\205" }, /* Aring */
+	{ 14113, 6, "\342\212\223\357\270\200" }, /* sqcaps */
+	{ 11698, 11, "\342\206\233" }, /* nrightarrow */
+	{ 9411, 5, "\306\265" }, /* imped */
+	{ 14625, 8, "\342\212\207" }, /* supseteq */
+	{ 4533, 11, "\342\207\200" }, /* RightVector */
+	{ 14411, 6, "\342\253\207" }, /* subsim */
+	{ 1729, 4, "\320\225" }, /* IEcy */
+	{ 1099, 18, "\342\245\237" }, /* DownRightTeeVector */
+	{ 4838, 19, "\342\212\222" }, /* SquareSupersetEqual */
+	{ 15203, 3, "\321\203" }, /* ucy */
+	{ 14102, 4, "\342\210\245" }, /* spar */
+	{ 9709, 5, "\342\244\216" }, /* lBarr */
+	{ 5178, 8, "\342\245\211" }, /* Uarrocir */
+	{ 1200, 3, "\303\220" }, /* ETH */
+	{ 2206, 15, "\342\245\216" }, /* LeftRightVector */
+	{ 15851, 2, "\342\211\200" }, /* wr */
+	{ 4641, 6, "\305\232" }, /* Sacute */
+	{ 1965, 3, "\360\235\224\216" }, /* Kfr */
+	{ 12147, 6, "\303\263" }, /* oacute */
+	{ 6859, 5, "\342\224\244" }, /* boxvl */
+	{ 7123, 9, "\342\234\223" }, /* checkmark */
+	{ 15172, 6, "\303\272" }, /* uacute */
+	{ 6962, 6, "\342\211\217" }, /* bumpeq */
+	{ 0, 0, "" },
+	{ 9180, 3, "\360\235\224\245" }, /* hfr */
+	{ 9937, 4, "\173" }, /* lcub */
+	{ 1961, 3, "\320\232" }, /* Kcy */
+	{ 14726, 6, "\342\214\226" }, /* target */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 2871, 7, "\012" }, /* NewLine */
+	{ 2483, 9, "\342\211\262" }, /* LessTilde */
+	{ 10043, 14, "\342\207\207" }, /* leftleftarrows */
+	{ 0, 0, "" },
+	{ 5533, 12, "\174" }, /* VerticalLine */
+	{ 5024, 4, "\320\246" }, /* TScy */
+	{ 10854, 8, "\342\206\245" }, /* mapstoup */
+	{ 15361, 5, "\342\212\216" }, /* uplus */
+	{ 4073, 4, "\360\235\222\253" }, /* Pscr */
+	{ 0, 0, "" },
+	{ 142, 7, "\342\210\265" }, /* Because */
+	{ 0, 0, "" },
+	{ 8608, 5, "\342\253\231" }, /* forkv */
+	{ 14598, 5, "\342\253\214" }, /* supnE */
+	{ 0, 0, "" },
+	{ 7724, 3, "\320\264" }, /* dcy */
+	{ 7487, 3, "\342\210\252" }, /* cup */
+	{ 5730, 4, "\305\273" }, /* Zdot */
+	{ 12110, 5, "\342\207\226" }, /* nwArr */
+	{ 5697, 4, "\360\235\222\264" }, /* Yscr */
+	{ 10915, 3, "\342\210\243" }, /* mid */
+	{ 1443, 10, "\342\204\261" }, /* Fouriertrf */
+	{ 2677, 11, "\342\201\237" }, /* MediumSpace */
+	{ 15098, 4, "\360\235\223\211" }, /* tscr */
+	{ 0, 0, "" },
+	{ 4884, 6, "\342\213\220" }, /* Subset */
+	{ 440, 15, "\342\210\256" }, /* ContourIntegral */
+	{ 12513, 7, "\342\200\261" }, /* pertenk */
+	{ 15940, 6, "\342\250\201" }, /* xoplus */
+	{ 4926, 18, "\342\211\275" }, /* SucceedsSlantEqual */
+	{ 10940, 5, "\342\210\222" }, /* minus */
+	{ 0, 0, "" },
+	{ 13772, 4, "\342\213\205" }, /* sdot */
+	{ 9047, 10, "\342\252\214" }, /* gtreqqless */
+	{ 9261, 6, "\342\204\217" }, /* hslash */
+	{ 4761, 4, "\342\210\232" }, /* Sqrt */
+	{ 15372, 5, "\317\222" }, /* upsih */
+	{ 15103, 4, "\321\206" }, /* tscy */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 12225, 6, "\303\262" }, /* ograve */
+	{ 14303, 4, "\342\253\205" }, /* subE */
+	{ 8025, 8, "\342\244\220" }, /* drbkarow */
+	{ 14400, 10, "\342\253\213" }, /* subsetneqq */
+	{ 15825, 6, "\342\211\231" }, /* wedgeq */
+	{ 5243, 10, "\342\217\237" }, /* UnderBrace */
+	{ 9023, 6, "\342\245\270" }, /* gtrarr */
+	{ 0, 0, "" },
+	{ 8833, 6, "\342\252\200" }, /* gesdot */
+	{ 15985, 5, "\342\226\263" }, /* xutri */
+	{ 13956, 5, "\342\252\240" }, /* simgE */
+	{ 4648, 2, "\342\252\274" }, /* Sc */
+	{ 13595, 6, "\342\200\272" }, /* rsaquo */
+	{ 15680, 3, "\320\262" }, /* vcy */
+	{ 11611, 9, "\342\210\246" }, /* nparallel */
+	{ 1480, 6, "\304\236" }, /* Gbreve */
+	{ 276, 7, "\302\270" }, /* Cedilla */
+	{ 0, 0, "" },
+	{ 8207, 6, "\342\252\230" }, /* egsdot */
+	{ 14843, 5, "\342\211\210" }, /* thkap */
+	{ 11415, 3, "\342\211\246\314\270" }, /* nlE */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 4349, 18, "\342\245\225" }, /* RightDownVectorBar */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 2243, 13, "\342\245\232" }, /* LeftTeeVector */
+	{ 11249, 5, "\342\207\227" }, /* neArr */
+	{ 0, 5, "\303\206" }, /* AElig */
+	{ 12525, 3, "\317\206" }, /* phi */
+	{ 0, 0, "" },
+	{ 170, 4, "\360\235\224\271" }, /* Bopf */
+	{ 0, 0, "" },
+	{ 8438, 4, "\342\204\257" }, /* escr */
+	{ 8389, 6, "\075" }, /* equals */
+	{ 7650, 5, "\342\210\261" }, /* cwint */
+	{ 13669, 7, "\342\245\250" }, /* ruluhar */
+	{ 1161, 12, "\342\206\247" }, /* DownTeeArrow */
+	{ 0, 0, "" },
+	{ 1787, 10, "\342\205\210" }, /* ImaginaryI */
+	{ 5234, 8, "\137" }, /* UnderBar */
+	{ 14342, 5, "\342\212\212" }, /* subne */
+	{ 509, 4, "\360\235\222\236" }, /* Cscr */
+	{ 5764, 4, "\360\235\222\265" }, /* Zscr */
+	{ 11493, 5, "\342\211\264" }, /* nlsim */
+	{ 13153, 6, "\135" }, /* rbrack */
+	{ 3754, 5, "\303\224" }, /* Ocirc */
+	{ 12064, 6, "\342\244\202" }, /* nvlArr */
+	{ 6830, 4, "\342\224\202" }, /* boxv */
+	{ 2599, 14, "\342\237\271" }, /* Longrightarrow */
+	{ 10662, 4, "\133" }, /* lsqb */
+	{ 9138, 4, "\342\204\217" }, /* hbar */
+	{ 11430, 3, "\342\211\260" }, /* nle */
+	{ 11590, 7, "\342\213\276" }, /* notnivb */
+	{ 15081, 7, "\342\250\273" }, /* tritime */
+	{ 13368, 14, "\342\207\200" }, /* rightharpoonup */
+	{ 9613, 4, "\360\235\225\233" }, /* jopf */
+	{ 11716, 6, "\342\213\255" }, /* nrtrie */
+	{ 9691, 5, "\342\207\232" }, /* lAarr */
+	{ 7687, 4, "\342\206\223" }, /* darr */
+	{ 1907, 3, "\320\231" }, /* Jcy */
+	{ 7466, 5, "\342\213\237" }, /* cuesc */
+	{ 6544, 5, "\342\226\221" }, /* blk14 */
+	{ 0, 0, "" },
+	{ 9506, 4, "\360\235\225\232" }, /* iopf */
+	{ 1634, 6, "\320\252" }, /* HARDcy */
+	{ 9289, 6, "\303\255" }, /* iacute */
+	{ 8569, 4, "\342\231\255" }, /* flat */
+	{ 11658, 5, "\342\212\200" }, /* nprec */
+	{ 7452, 7, "\342\244\265" }, /* cudarrr */
+	{ 8591, 4, "\360\235\225\227" }, /* fopf */
+	{ 10168, 5, "\342\252\250" }, /* lescc */
+	{ 15966, 4, "\360\235\223\215" }, /* xscr */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 16015, 5, "\305\267" }, /* ycirc */
+	{ 12669, 4, "\360\235\225\241" }, /* popf */
+	{ 0, 0, "" },
+	{ 284, 9, "\302\267" }, /* CenterDot */
+	{ 104, 6, "\303\203" }, /* Atilde */
+	{ 8748, 3, "\342\252\214" }, /* gEl */
+	{ 0, 0, "" },
+	{ 12775, 5, "\342\200\262" }, /* prime */
+	{ 9460, 8, "\342\204\244" }, /* integers */
+	{ 2321, 15, "\342\245\240" }, /* LeftUpTeeVector */
+	{ 2391, 9, "\342\207\220" }, /* Leftarrow */
+	{ 14497, 7, "\342\211\277" }, /* succsim */
+	{ 650, 16, "\140" }, /* DiacriticalGrave */
+	{ 0, 0, "" },
+	{ 3697, 13, "\342\211\211" }, /* NotTildeTilde */
+	{ 12246, 4, "\342\210\256" }, /* oint */
+	{ 11216, 5, "\342\211\207" }, /* ncong */
+	{ 14240, 6, "\342\214\243" }, /* ssmile */
+	{ 1464, 2, "\076" }, /* GT */
+	{ 0, 0, "" },
+	{ 15913, 5, "\342\237\265" }, /* xlarr */
+	{ 10310, 5, "\342\226\204" }, /* lhblk */
+	{ 11222, 8, "\342\251\255\314\270" }, /* ncongdot */
+	{ 12501, 6, "\342\200\260" }, /* permil */
+	{ 13909, 5, "\317\203" }, /* sigma */
+	{ 9804, 6, "\342\244\235" }, /* larrfs */
+	{ 0, 0, "" },
+	{ 13560, 7, "\342\250\265" }, /* rotimes */
+	{ 5228, 5, "\305\252" }, /* Umacr */
+	{ 8070, 5, "\342\213\261" }, /* dtdot */
+	{ 0, 0, "" },
+	{ 12174, 5, "\342\212\235" }, /* odash */
+	{ 11886, 5, "\342\212\211" }, /* nsupe */
+	{ 13182, 6, "\305\231" }, /* rcaron */
+	{ 14749, 6, "\305\243" }, /* tcedil */
+	{ 3357, 21, "\342\213\240" }, /* NotPrecedesSlantEqual */
+	{ 5398, 11, "\342\207\225" }, /* Updownarrow */
+	{ 15197, 5, "\303\273" }, /* ucirc */
+	{ 14172, 6, "\342\212\222" }, /* sqsupe */
+	{ 13105, 5, "\342\206\235" }, /* rarrw */
+	{ 0, 0, "" },
+	{ 92, 4, "\360\235\222\234" }, /* Ascr */
+	{ 8508, 13, "\342\211\222" }, /* fallingdotseq */
+	{ 11799, 7, "\342\213\242" }, /* nsqsube */
+	{ 11179, 4, "\302\240" }, /* nbsp */
+	{ 57, 3, "\342\251\223" }, /* And */
+	{ 11382, 5, "\342\253\262" }, /* nhpar */
+	{ 7017, 4, "\342\210\251\357\270\200" }, /* caps */
+	{ 10656, 5, "\342\252\217" }, /* lsimg */
+	{ 8798, 2, "\342\211\245" }, /* ge */
+	{ 0, 0, "" },
+	{ 6667, 5, "\342\225\234" }, /* boxUl */
+	{ 16048, 4, "\321\216" }, /* yucy */
+	{ 2148, 14, "\342\207\203" }, /* LeftDownVector */
+	{ 11400, 3, "\342\210\213" }, /* niv */
+	{ 12318, 4, "\342\246\267" }, /* opar */
+	{ 4402, 14, "\342\245\233" }, /* RightTeeVector */
+	{ 12313, 4, "\360\235\225\240" }, /* oopf */
+	{ 8596, 6, "\342\210\200" }, /* forall */
+	{ 5075, 10, "\342\201\237\342\200\212" }, /* ThickSpace */
+	{ 3679, 17, "\342\211\207" }, /* NotTildeFullEqual */
+	{ 6004, 8, "\342\246\235" }, /* angrtvbd */
+	{ 0, 0, "" },
+	{ 6924, 8, "\342\237\210" }, /* bsolhsub */
+	{ 0, 0, "" },
+	{ 131, 6, "\342\214\206" }, /* Barwed */
+	{ 4516, 16, "\342\245\224" }, /* RightUpVectorBar */
+	{ 0, 0, "" },
+	{ 14126, 6, "\342\212\224\357\270\200" }, /* sqcups */
+	{ 12271, 5, "\342\200\276" }, /* oline */
+	{ 11850, 10, "\342\253\205\314\270" }, /* nsubseteqq */
+	{ 5776, 6, "\304\203" }, /* abreve */
+	{ 0, 0, "" },
+	{ 14808, 6, "\317\221" }, /* thetav */
+	{ 9575, 6, "\304\251" }, /* itilde */
+	{ 8217, 8, "\342\217\247" }, /* elinters */
+	{ 6824, 5, "\342\224\224" }, /* boxur */
+	{ 5051, 3, "\320\242" }, /* Tcy */
+	{ 5596, 4, "\360\235\225\215" }, /* Vopf */
+	{ 0, 0, "" },
+	{ 5284, 5, "\342\213\203" }, /* Union */
+	{ 0, 0, "" },
+	{ 8776, 6, "\304\237" }, /* gbreve */
+	{ 3851, 6, "\303\230" }, /* Oslash */
+	{ 2500, 10, "\342\207\232" }, /* Lleftarrow */
+	{ 5033, 3, "\316\244" }, /* Tau */
+	{ 3711, 14, "\342\210\244" }, /* NotVerticalBar */
+	{ 3534, 9, "\342\212\202\342\203\222" }, /* NotSubset */
+	{ 12367, 4, "\302\272" }, /* ordm */
+	{ 15777, 6, "\342\212\212\357\270\200" }, /* vsubne */
+	{ 11350, 4, "\342\251\276\314\270" }, /* nges */
+	{ 10422, 5, "\342\207\275" }, /* loarr */
+	{ 8745, 2, "\342\211\247" }, /* gE */
+	{ 6768, 5, "\342\224\254" }, /* boxhd */
+	{ 11246, 2, "\342\211\240" }, /* ne */
+	{ 14566, 7, "\342\237\211" }, /* suphsol */
+	{ 8805, 3, "\342\211\245" }, /* geq */
+	{ 3865, 6, "\342\250\267" }, /* Otimes */
+	{ 13399, 17, "\342\207\214" }, /* rightleftharpoons */
+	{ 7098, 9, "\302\267" }, /* centerdot */
+	{ 12955, 6, "\342\244\234" }, /* rAtail */
+	{ 15919, 4, "\342\237\274" }, /* xmap */
+	{ 1244, 7, "\342\210\210" }, /* Element */
+	{ 6720, 6, "\342\247\211" }, /* boxbox */
+	{ 10612, 6, "\342\245\255" }, /* lrhard */
+	{ 7916, 8, "\342\211\221" }, /* doteqdot */
+	{ 9566, 5, "\342\210\210" }, /* isinv */
+	{ 10266, 6, "\342\245\274" }, /* lfisht */
+	{ 8915, 8, "\342\252\212" }, /* gnapprox */
+	{ 0, 0, "" },
+	{ 12000, 2, "\316\275" }, /* nu */
+	{ 0, 0, "" },
+	{ 14380, 9, "\342\253\205" }, /* subseteqq */
+	{ 9417, 2, "\342\210\210" }, /* in */
+	{ 15420, 5, "\305\257" }, /* uring */
+	{ 7146, 4, "\313\206" }, /* circ */
+	{ 0, 0, "" },
+	{ 9895, 5, "\342\246\213" }, /* lbrke */
+	{ 97, 6, "\342\211\224" }, /* Assign */
+	{ 16088, 4, "\316\266" }, /* zeta */
+	{ 8721, 6, "\342\205\236" }, /* frac78 */
+	{ 8734, 5, "\342\214\242" }, /* frown */
+	{ 15053, 4, "\342\211\234" }, /* trie */
+	{ 11509, 6, "\342\213\254" }, /* nltrie */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 9715, 2, "\342\211\246" }, /* lE */
+	{ 5905, 5, "\342\210\240" }, /* angle */
+	{ 15426, 5, "\342\227\271" }, /* urtri */
+	{ 9442, 6, "\304\261" }, /* inodot */
+	{ 0, 0, "" },
+	{ 7992, 15, "\342\207\203" }, /* downharpoonleft */
+	{ 12338, 5, "\342\206\273" }, /* orarr */
+	{ 12039, 6, "\342\212\254" }, /* nvdash */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 12306, 6, "\342\212\226" }, /* ominus */
+	{ 6059, 3, "\342\211\212" }, /* ape */
+	{ 8087, 5, "\342\207\265" }, /* duarr */
+	{ 4665, 5, "\305\234" }, /* Scirc */
+	{ 14222, 5, "\342\206\222" }, /* srarr */
+	{ 8840, 7, "\342\252\202" }, /* gesdoto */
+	{ 7209, 10, "\342\212\233" }, /* circledast */
+	{ 13211, 4, "\342\244\267" }, /* rdca */
+	{ 4694, 14, "\342\206\220" }, /* ShortLeftArrow */
+	{ 9981, 4, "\342\206\262" }, /* ldsh */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 12392, 3, "\342\251\233" }, /* orv */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 7066, 7, "\342\251\220" }, /* ccupssm */
+	{ 2655, 3, "\342\206\260" }, /* Lsh */
+	{ 0, 0, "" },
+	{ 5410, 14, "\342\206\226" }, /* UpperLeftArrow */
+	{ 13648, 5, "\342\212\265" }, /* rtrie */
+	{ 5477, 5, "\342\212\253" }, /* VDash */
+	{ 15213, 6, "\305\261" }, /* udblac */
+	{ 6756, 5, "\342\225\245" }, /* boxhD */
+	{ 2130, 17, "\342\245\241" }, /* LeftDownTeeVector */
+	{ 8848, 8, "\342\252\204" }, /* gesdotol */
+	{ 10687, 2, "\074" }, /* lt */
+	{ 1431, 4, "\360\235\224\275" }, /* Fopf */
+	{ 8972, 5, "\342\252\220" }, /* gsiml */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 9999, 13, "\342\206\242" }, /* leftarrowtail */
+	{ 0, 0, "" },
+	{ 13857, 6, "\342\214\242" }, /* sfrown */
+	{ 9299, 5, "\303\256" }, /* icirc */
+	{ 4333, 15, "\342\207\202" }, /* RightDownVector */
+	{ 10203, 6, "\342\252\223" }, /* lesges */
+	{ 7244, 4, "\342\211\227" }, /* cire */
+	{ 875, 20, "\342\237\271" }, /* DoubleLongRightArrow */
+	{ 13062, 6, "\342\244\236" }, /* rarrfs */
+	{ 0, 0, "" },
+	{ 9112, 6, "\321\212" }, /* hardcy */
+	{ 1613, 12, "\342\211\263" }, /* GreaterTilde */
+	{ 1500, 3, "\320\223" }, /* Gcy */
+	{ 0, 0, "" },
+	{ 12197, 6, "\342\246\274" }, /* odsold */
+	{ 5972, 8, "\342\246\256" }, /* angmsdag */
+	{ 16081, 6, "\342\204\250" }, /* zeetrf */
+	{ 5193, 6, "\305\254" }, /* Ubreve */
+	{ 15730, 5, "\342\212\262" }, /* vltri */
+	{ 13705, 6, "\305\241" }, /* scaron */
+	{ 9229, 14, "\342\206\252" }, /* hookrightarrow */
+	{ 14925, 4, "\360\235\225\245" }, /* topf */
+	{ 9119, 4, "\342\206\224" }, /* harr */
+	{ 2257, 12, "\342\212\262" }, /* LeftTriangle */
+	{ 7952, 14, "\342\214\206" }, /* doublebarwedge */
+	{ 8269, 4, "\342\200\203" }, /* emsp */
+	{ 1938, 4, "\320\245" }, /* KHcy */
+	{ 1184, 4, "\360\235\222\237" }, /* Dscr */
+	{ 7294, 6, "\342\211\224" }, /* colone */
+	{ 15207, 5, "\342\207\205" }, /* udarr */
+	{ 0, 0, "" },
+	{ 2835, 20, "\342\211\253" }, /* NestedGreaterGreater */
+	{ 116, 9, "\342\210\226" }, /* Backslash */
+	{ 547, 4, "\320\217" }, /* DZcy */
+	{ 11122, 4, "\342\210\240\342\203\222" }, /* nang */
+	{ 9037, 9, "\342\213\233" }, /* gtreqless */
+	{ 12905, 11, "\342\204\215" }, /* quaternions */
+	{ 7432, 5, "\342\253\222" }, /* csupe */
+	{ 6913, 4, "\134" }, /* bsol */
+	{ 2917, 12, "\342\211\242" }, /* NotCongruent */
+	{ 2913, 3, "\342\253\254" }, /* Not */
+	{ 0, 0, "" },
+	{ 12628, 5, "\342\251\262" }, /* pluse */
+	{ 3151, 15, "\342\213\252" }, /* NotLeftTriangle */
+	{ 15690, 3, "\342\210\250" }, /* vee */
+	{ 830, 19, "\342\237\270" }, /* DoubleLongLeftArrow */
+	{ 15663, 16, "\342\212\263" }, /* vartriangleright */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 6159, 11, "\317\266" }, /* backepsilon */
+	{ 13247, 7, "\342\204\233" }, /* realine */
+	{ 12591, 8, "\342\250\243" }, /* plusacir */
+	{ 0, 0, "" },
+	{ 564, 5, "\342\253\244" }, /* Dashv */
+	{ 6987, 8, "\342\251\211" }, /* capbrcup */
+	{ 8580, 5, "\342\226\261" }, /* fltns */
+	{ 0, 0, "" },
+	{ 12408, 4, "\342\212\230" }, /* osol */
+	{ 0, 0, "" },
+	{ 10721, 6, "\342\245\266" }, /* ltlarr */
+	{ 0, 0, "" },
+	{ 4744, 11, "\342\210\230" }, /* SmallCircle */
+	{ 570, 6, "\304\216" }, /* Dcaron */
+	{ 14793, 5, "\316\270" }, /* theta */
+	{ 5712, 6, "\305\271" }, /* Zacute */
+	{ 0, 0, "" },
+	{ 14856, 5, "\303\276" }, /* thorn */
+	{ 4262, 19, "\342\207\204" }, /* RightArrowLeftArrow */
+	{ 13500, 6, "\342\216\261" }, /* rmoust */
+	{ 0, 0, "" },
+	{ 8417, 8, "\342\247\245" }, /* eqvparsl */
+	{ 15701, 5, "\342\211\232" }, /* veeeq */
+	{ 12767, 7, "\342\211\276" }, /* precsim */
+	{ 14188, 10, "\342\212\222" }, /* sqsupseteq */
+	{ 243, 6, "\304\214" }, /* Ccaron */
+	{ 15765, 4, "\360\235\223\213" }, /* vscr */
+	{ 13042, 5, "\342\207\245" }, /* rarrb */
+	{ 1001, 16, "\342\207\265" }, /* DownArrowUpArrow */
+	{ 6095, 4, "\360\235\222\266" }, /* ascr */
+	{ 13336, 14, "\342\206\243" }, /* rightarrowtail */
+	{ 6073, 6, "\342\211\210" }, /* approx */
+	{ 3610, 16, "\342\211\277\314\270" }, /* NotSucceedsTilde */
+	{ 9539, 5, "\342\213\271" }, /* isinE */
+	{ 0, 0, "" },
+	{ 1806, 3, "\342\210\254" }, /* Int */
+	{ 15184, 5, "\321\236" }, /* ubrcy */
+	{ 10992, 4, "\360\235\225\236" }, /* mopf */
+	{ 0, 0, "" },
+	{ 14654, 10, "\342\253\214" }, /* supsetneqq */
+	{ 11875, 4, "\342\212\205" }, /* nsup */
+	{ 6332, 7, "\342\250\200" }, /* bigodot */
+	{ 0, 0, "" },
+	{ 13083, 6, "\342\245\205" }, /* rarrpl */
+	{ 7731, 7, "\342\200\241" }, /* ddagger */
+	{ 7249, 8, "\342\250\220" }, /* cirfnint */
+	{ 324, 10, "\342\212\225" }, /* CirclePlus */
+	{ 13320, 4, "\317\261" }, /* rhov */
+	{ 175, 5, "\313\230" }, /* Breve */
+	{ 14705, 7, "\342\206\231" }, /* swarrow */
+	{ 3858, 6, "\303\225" }, /* Otilde */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 3807, 20, "\342\200\234" }, /* OpenCurlyDoubleQuote */
+	{ 0, 0, "" },
+	{ 13434, 15, "\342\206\235" }, /* rightsquigarrow */
+	{ 8961, 4, "\342\211\263" }, /* gsim */
+	{ 0, 0, "" },
+	{ 9124, 7, "\342\245\210" }, /* harrcir */
+	{ 9972, 8, "\342\245\213" }, /* ldrushar */
+	{ 0, 0, "" },
+	{ 3788, 5, "\316\251" }, /* Omega */
+	{ 11582, 7, "\342\210\214" }, /* notniva */
+	{ 4589, 11, "\342\207\233" }, /* Rrightarrow */
+	{ 10870, 6, "\342\250\251" }, /* mcomma */
+	{ 11815, 4, "\342\212\204" }, /* nsub */
+	{ 1810, 8, "\342\210\253" }, /* Integral */
+	{ 181, 4, "\342\204\254" }, /* Bscr */
+	{ 6181, 7, "\342\210\275" }, /* backsim */
+	{ 13255, 8, "\342\204\234" }, /* realpart */
+	{ 0, 0, "" },
+	{ 8814, 8, "\342\251\276" }, /* geqslant */
+	{ 8876, 3, "\342\213\231" }, /* ggg */
+	{ 15854, 6, "\342\211\200" }, /* wreath */
+	{ 9328, 6, "\303\254" }, /* igrave */
+	{ 7151, 6, "\342\211\227" }, /* circeq */
+	{ 12034, 4, "\342\211\215\342\203\222" }, /* nvap */
+	{ 8189, 3, "\360\235\224\242" }, /* efr */
+	{ 4634, 6, "\320\254" }, /* SOFTcy */
+	{ 6774, 5, "\342\224\264" }, /* boxhu */
+	{ 5516, 4, "\342\200\226" }, /* Vert */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 1174, 9, "\342\207\223" }, /* Downarrow */
+	{ 6878, 5, "\313\230" }, /* breve */
+	{ 0, 0, "" },
+	{ 7368, 6, "\342\210\256" }, /* conint */
+	{ 7085, 7, "\342\246\262" }, /* cemptyv */
+	{ 13417, 16, "\342\207\211" }, /* rightrightarrows */
+	{ 3775, 6, "\303\222" }, /* Ograve */
+	{ 0, 0, "" },
+	{ 14720, 5, "\303\237" }, /* szlig */
+	{ 13293, 3, "\360\235\224\257" }, /* rfr */
+	{ 0, 0, "" },
+	{ 2776, 18, "\342\200\213" }, /* NegativeThickSpace */
+	{ 5707, 4, "\320\226" }, /* ZHcy */
+	{ 9083, 4, "\342\211\251\357\270\200" }, /* gvnE */
+	{ 13490, 5, "\342\207\214" }, /* rlhar */
+	{ 8700, 6, "\342\205\230" }, /* frac45 */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 433, 6, "\342\210\257" }, /* Conint */
+	{ 2723, 2, "\316\234" }, /* Mu */
+	{ 12287, 5, "\317\211" }, /* omega */
+	{ 13536, 5, "\342\237\247" }, /* robrk */
+	{ 5564, 13, "\342\211\200" }, /* VerticalTilde */
+	{ 14179, 8, "\342\212\220" }, /* sqsupset */
+	{ 15563, 4, "\342\206\225" }, /* varr */
+	{ 9427, 5, "\342\210\236" }, /* infin */
+	{ 9305, 3, "\320\270" }, /* icy */
+	{ 14015, 6, "\342\250\263" }, /* smashp */
+	{ 7668, 4, "\342\245\245" }, /* dHar */
+	{ 8034, 6, "\342\214\237" }, /* drcorn */
+	{ 715, 6, "\342\203\234" }, /* DotDot */
+	{ 7745, 7, "\342\251\267" }, /* ddotseq */
+	{ 12698, 3, "\342\252\257" }, /* pre */
+	{ 14618, 6, "\342\212\203" }, /* supset */
+	{ 15413, 6, "\342\214\216" }, /* urcrop */
+	{ 4135, 6, "\305\230" }, /* Rcaron */
+	{ 12931, 7, "\342\211\237" }, /* questeq */
+	{ 210, 3, "\342\213\222" }, /* Cap */
+	{ 2981, 13, "\342\211\202\314\270" }, /* NotEqualTilde */
+	{ 13864, 5, "\342\231\257" }, /* sharp */
+	{ 9282, 6, "\342\200\220" }, /* hyphen */
+	{ 1762, 4, "\304\260" }, /* Idot */
+	{ 16097, 4, "\320\266" }, /* zhcy */
+	{ 14574, 7, "\342\253\227" }, /* suphsub */
+	{ 0, 0, "" },
+	{ 2532, 18, "\342\237\267" }, /* LongLeftRightArrow */
+	{ 12379, 4, "\342\251\226" }, /* oror */
+	{ 0, 0, "" },
+	{ 10901, 3, "\360\235\224\252" }, /* mfr */
+	{ 0, 0, "" },
+	{ 9676, 4, "\321\234" }, /* kjcy */
+	{ 5290, 9, "\342\212\216" }, /* UnionPlus */
+	{ 15367, 4, "\317\205" }, /* upsi */
+	{ 2191, 14, "\342\206\224" }, /* LeftRightArrow */
+	{ 8801, 3, "\342\213\233" }, /* gel */
+	{ 753, 9, "\302\250" }, /* DoubleDot */
+	{ 0, 0, "" },
+	{ 1661, 12, "\342\204\213" }, /* HilbertSpace */
+	{ 5601, 4, "\360\235\222\261" }, /* Vscr */
+	{ 11127, 3, "\342\211\211" }, /* nap */
+	{ 12893, 6, "\342\201\227" }, /* qprime */
+	{ 15597, 13, "\342\253\213\357\270\200" }, /* varsubsetneqq */
+	{ 7460, 5, "\342\213\236" }, /* cuepr */
+	{ 8127, 4, "\342\211\221" }, /* eDot */
+	{ 1948, 5, "\316\232" }, /* Kappa */
+	{ 7629, 5, "\342\213\216" }, /* cuvee */
+	{ 15058, 8, "\342\250\272" }, /* triminus */
+	{ 11621, 6, "\342\253\275\342\203\245" }, /* nparsl */
+	{ 0, 0, "" },
+	{ 12850, 5, "\342\211\276" }, /* prsim */
+	{ 14902, 4, "\342\244\250" }, /* toea */
+	{ 15075, 5, "\342\247\215" }, /* trisb */
+	{ 10404, 5, "\342\211\250" }, /* lneqq */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 1699, 6, "\304\246" }, /* Hstrok */
+	{ 4417, 13, "\342\212\263" }, /* RightTriangle */
+	{ 2879, 3, "\360\235\224\221" }, /* Nfr */
+	{ 0, 0, "" },
+	{ 10386, 8, "\342\252\211" }, /* lnapprox */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 913, 14, "\342\212\250" }, /* DoubleRightTee */
+	{ 5267, 16, "\342\217\235" }, /* UnderParenthesis */
+	{ 0, 0, "" },
+	{ 1332, 11, "\342\207\214" }, /* Equilibrium */
+	{ 5055, 3, "\360\235\224\227" }, /* Tfr */
+	{ 0, 0, "" },
+	{ 11910, 10, "\342\253\206\314\270" }, /* nsupseteqq */
+	{ 12820, 8, "\342\214\222" }, /* profline */
+	{ 6584, 3, "\342\212\245" }, /* bot */
+	{ 2006, 10, "\342\204\222" }, /* Laplacetrf */
+	{ 0, 0, "" },
+	{ 7232, 11, "\342\212\235" }, /* circleddash */
+	{ 1509, 3, "\360\235\224\212" }, /* Gfr */
+	{ 6306, 3, "\360\235\224\237" }, /* bfr */
+	{ 0, 0, "" },
+	{ 9869, 5, "\342\244\214" }, /* lbarr */
+	{ 0, 0, "" },
+	{ 12436, 4, "\303\266" }, /* ouml */
+	{ 3167, 18, "\342\247\217\314\270" }, /* NotLeftTriangleBar */
+	{ 1307, 7, "\316\225" }, /* Epsilon */
+	{ 6104, 5, "\342\211\210" }, /* asymp */
+	{ 0, 0, "" },
+	{ 12344, 3, "\342\251\235" }, /* ord */
+	{ 0, 0, "" },
+	{ 928, 13, "\342\207\221" }, /* DoubleUpArrow */
+	{ 5319, 10, "\342\244\222" }, /* UpArrowBar */
+	{ 0, 0, "" },
+	{ 13242, 4, "\342\204\234" }, /* real */
+	{ 1920, 4, "\360\235\222\245" }, /* Jscr */
+	{ 8772, 3, "\342\252\206" }, /* gap */
+	{ 15226, 6, "\342\245\276" }, /* ufisht */
+	{ 271, 4, "\304\212" }, /* Cdot */
+	{ 0, 0, "" },
+	{ 9603, 3, "\360\235\224\247" }, /* jfr */
+	{ 5139, 4, "\360\235\225\213" }, /* Topf */
+	{ 4156, 14, "\342\210\213" }, /* ReverseElement */
+	{ 12014, 5, "\342\200\207" }, /* numsp */
+	{ 5096, 5, "\342\210\274" }, /* Tilde */
+	{ 0, 0, "" },
+	{ 3310, 17, "\342\252\241\314\270" }, /* NotNestedLessLess */
+	{ 16053, 4, "\303\277" }, /* yuml */
+	{ 8809, 4, "\342\211\247" }, /* geqq */
+	{ 12046, 4, "\342\211\245\342\203\222" }, /* nvge */
+	{ 6727, 5, "\342\225\225" }, /* boxdL */
+	{ 5306, 4, "\360\235\225\214" }, /* Uopf */
+	{ 0, 0, "" },
+	{ 6052, 6, "\342\251\257" }, /* apacir */
+	{ 0, 0, "" },
+	{ 11142, 5, "\305\211" }, /* napos */
+	{ 15297, 3, "\302\250" }, /* uml */
+	{ 15888, 3, "\360\235\224\265" }, /* xfr */
+	{ 11807, 7, "\342\213\243" }, /* nsqsupe */
+	{ 9858, 4, "\342\252\255" }, /* late */
+	{ 6602, 5, "\342\225\227" }, /* boxDL */
+	{ 10636, 4, "\360\235\223\201" }, /* lscr */
+	{ 5684, 3, "\320\253" }, /* Ycy */
+	{ 4049, 10, "\342\210\267" }, /* Proportion */
+	{ 0, 0, "" },
+	{ 15584, 12, "\342\212\212\357\270\200" }, /* varsubsetneq */
+	{ 13696, 3, "\342\252\264" }, /* scE */
+	{ 9649, 6, "\304\267" }, /* kcedil */
+	{ 9572, 2, "\342\201\242" }, /* it */
+	{ 2634, 15, "\342\206\230" }, /* LowerRightArrow */
+	{ 8686, 6, "\342\205\227" }, /* frac35 */
+	{ 14938, 4, "\342\244\251" }, /* tosa */
+	{ 6945, 4, "\342\211\216" }, /* bump */
+	{ 9671, 4, "\321\205" }, /* khcy */
+	{ 0, 0, "" },
+	{ 12939, 4, "\042" }, /* quot */
+	{ 11365, 4, "\342\211\257" }, /* ngtr */
+	{ 14665, 6, "\342\253\210" }, /* supsim */
+	{ 1925, 6, "\320\210" }, /* Jsercy */
+	{ 12076, 4, "\074\342\203\222" }, /* nvlt */
+	{ 13216, 7, "\342\245\251" }, /* rdldhar */
+	{ 5692, 4, "\360\235\225\220" }, /* Yopf */
+	{ 0, 0, "" },
+	{ 13629, 6, "\342\213\214" }, /* rthree */
+	{ 13816, 4, "\302\247" }, /* sect */
+	{ 16021, 3, "\321\213" }, /* ycy */
+	{ 7591, 6, "\302\244" }, /* curren */
+	{ 8132, 6, "\303\251" }, /* eacute */
+	{ 11472, 9, "\342\251\275\314\270" }, /* nleqslant */
+	{ 9478, 8, "\342\250\227" }, /* intlarhk */
+	{ 12529, 4, "\317\225" }, /* phiv */
+	{ 0, 0, "" },
+	{ 4248, 13, "\342\207\245" }, /* RightArrowBar */
+	{ 0, 0, "" },
+	{ 1745, 6, "\303\215" }, /* Iacute */
+	{ 5373, 5, "\342\212\245" }, /* UpTee */
+	{ 6368, 7, "\342\230\205" }, /* bigstar */
+	{ 4041, 7, "\342\210\217" }, /* Product */
+	{ 5666, 4, "\320\256" }, /* YUcy */
+	{ 1315, 5, "\342\251\265" }, /* Equal */
+	{ 6918, 5, "\342\247\205" }, /* bsolb */
+	{ 7273, 5, "\342\231\243" }, /* clubs */
+	{ 6034, 5, "\304\205" }, /* aogon */
+	{ 15450, 4, "\342\226\265" }, /* utri */
+	{ 0, 0, "" },
+	{ 5646, 4, "\360\235\225\217" }, /* Xopf */
+	{ 9840, 6, "\342\206\242" }, /* larrtl */
+	{ 16058, 6, "\305\272" }, /* zacute */
+	{ 0, 0, "" },
+	{ 6477, 17, "\342\226\276" }, /* blacktriangledown */
+	{ 2222, 7, "\342\212\243" }, /* LeftTee */
+	{ 15346, 14, "\342\206\276" }, /* upharpoonright */
+	{ 10641, 3, "\342\206\260" }, /* lsh */
+	{ 10416, 5, "\342\237\254" }, /* loang */
+	{ 13450, 15, "\342\213\214" }, /* rightthreetimes */
+	{ 2497, 2, "\342\213\230" }, /* Ll */
+	{ 1568, 14, "\342\252\242" }, /* GreaterGreater */
+	{ 15898, 5, "\342\237\267" }, /* xharr */
+	{ 9105, 6, "\342\204\213" }, /* hamilt */
+	{ 2447, 11, "\342\211\266" }, /* LessGreater */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 8274, 6, "\342\200\204" }, /* emsp13 */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 11255, 6, "\342\244\244" }, /* nearhk */
+	{ 8226, 3, "\342\204\223" }, /* ell */
+	{ 0, 0, "" },
+	{ 6406, 8, "\342\250\204" }, /* biguplus */
+	{ 5018, 5, "\320\213" }, /* TSHcy */
+	{ 731, 21, "\342\210\257" }, /* DoubleContourIntegral */
+	{ 9545, 7, "\342\213\265" }, /* isindot */
+	{ 15278, 6, "\342\214\217" }, /* ulcrop */
+	{ 0, 0, "" },
+	{ 10540, 7, "\342\250\264" }, /* lotimes */
+	{ 4756, 4, "\360\235\225\212" }, /* Sopf */
+	{ 9931, 5, "\342\214\210" }, /* lceil */
+	{ 5954, 8, "\342\246\254" }, /* angmsdae */
+	{ 9208, 6, "\342\210\273" }, /* homtht */
+	{ 3434, 21, "\342\213\255" }, /* NotRightTriangleEqual */
+	{ 14217, 4, "\342\226\252" }, /* squf */
+	{ 3255, 17, "\342\251\275\314\270" }, /* NotLessSlantEqual */
+	{ 6714, 5, "\342\225\237" }, /* boxVr */
+	{ 7697, 5, "\342\212\243" }, /* dashv */
+	{ 8164, 6, "\342\211\225" }, /* ecolon */
+	{ 12730, 6, "\342\252\257" }, /* preceq */
+	{ 15490, 5, "\342\253\251" }, /* vBarv */
+	{ 13000, 4, "\342\237\251" }, /* rang */
+	{ 11503, 5, "\342\213\252" }, /* nltri */
+	{ 12680, 2, "\342\211\272" }, /* pr */
+	{ 9989, 9, "\342\206\220" }, /* leftarrow */
+	{ 0, 0, "" },
+	{ 4219, 17, "\342\237\251" }, /* RightAngleBracket */
+	{ 16010, 4, "\321\217" }, /* yacy */
+	{ 3559, 11, "\342\212\201" }, /* NotSucceeds */
+	{ 12900, 4, "\360\235\223\206" }, /* qscr */
+	{ 11628, 5, "\342\210\202\314\270" }, /* npart */
+	{ 11409, 5, "\342\207\215" }, /* nlArr */
+	{ 7925, 8, "\342\210\270" }, /* dotminus */
+	{ 11793, 5, "\342\210\246" }, /* nspar */
+	{ 0, 0, "" },
+	{ 2580, 18, "\342\237\272" }, /* Longleftrightarrow */
+	{ 12413, 6, "\303\265" }, /* otilde */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 10164, 3, "\342\251\275" }, /* les */
+	{ 7753, 3, "\302\260" }, /* deg */
+	{ 3665, 13, "\342\211\204" }, /* NotTildeEqual */
+	{ 12657, 2, "\302\261" }, /* pm */
+	{ 0, 0, "" },
+	{ 8614, 8, "\342\250\215" }, /* fpartint */
+	{ 0, 0, "" },
+	{ 13124, 9, "\342\204\232" }, /* rationals */
+	{ 14448, 11, "\342\211\275" }, /* succcurlyeq */
+	{ 978, 9, "\342\206\223" }, /* DownArrow */
+	{ 13111, 6, "\342\244\232" }, /* ratail */
+	{ 13098, 6, "\342\206\243" }, /* rarrtl */
+	{ 0, 0, "" },
+	{ 9511, 4, "\316\271" }, /* iota */
+	{ 11466, 5, "\342\211\246\314\270" }, /* nleqq */
+	{ 0, 0, "" },
+	{ 5735, 14, "\342\200\213" }, /* ZeroWidthSpace */
+	{ 2650, 4, "\342\204\222" }, /* Lscr */
+	{ 5311, 7, "\342\206\221" }, /* UpArrow */
+	{ 6422, 8, "\342\213\200" }, /* bigwedge */
+	{ 11968, 14, "\342\213\253" }, /* ntriangleright */
+	{ 10985, 6, "\342\212\247" }, /* models */
+	{ 9309, 4, "\320\265" }, /* iecy */
+	{ 3215, 12, "\342\211\260" }, /* NotLessEqual */
+	{ 9132, 5, "\342\206\255" }, /* harrw */
+	{ 15929, 5, "\342\250\200" }, /* xodot */
+	{ 8458, 3, "\303\260" }, /* eth */
+	{ 4576, 12, "\342\245\260" }, /* RoundImplies */
+	{ 10073, 15, "\342\207\206" }, /* leftrightarrows */
+	{ 4976, 8, "\342\212\203" }, /* Superset */
+	{ 4149, 3, "\320\240" }, /* Rcy */
+	{ 0, 0, "" },
+	{ 2100, 11, "\342\214\210" }, /* LeftCeiling */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 13987, 7, "\342\245\262" }, /* simrarr */
+	{ 7680, 6, "\342\204\270" }, /* daleth */
+	{ 9582, 5, "\321\226" }, /* iukcy */
+	{ 5044, 6, "\305\242" }, /* Tcedil */
+	{ 9825, 6, "\342\244\271" }, /* larrpl */
+	{ 3571, 16, "\342\252\260\314\270" }, /* NotSucceedsEqual */
+	{ 13264, 5, "\342\204\235" }, /* reals */
+	{ 7711, 5, "\313\235" }, /* dblac */
+	{ 7327, 6, "\342\210\230" }, /* compfn */
+	{ 14254, 4, "\342\230\206" }, /* star */
+	{ 8297, 5, "\304\231" }, /* eogon */
+	{ 0, 0, "" },
+	{ 4368, 10, "\342\214\213" }, /* RightFloor */
+	{ 11543, 8, "\342\213\265\314\270" }, /* notindot */
+	{ 0, 0, "" },
+	{ 7641, 8, "\342\210\262" }, /* cwconint */
+	{ 8728, 5, "\342\201\204" }, /* frasl */
+	{ 10562, 3, "\342\227\212" }, /* loz */
+	{ 0, 0, "" },
+	{ 1134, 18, "\342\245\227" }, /* DownRightVectorBar */
+	{ 14582, 7, "\342\245\273" }, /* suplarr */
+	{ 14036, 5, "\342\214\243" }, /* smile */
+	{ 0, 0, "" },
+	{ 12879, 3, "\360\235\224\256" }, /* qfr */
+	{ 6438, 12, "\342\247\253" }, /* blacklozenge */
+	{ 10013, 15, "\342\206\275" }, /* leftharpoondown */
+	{ 0, 0, "" },
+	{ 7438, 5, "\342\213\257" }, /* ctdot */
+	{ 10933, 6, "\302\267" }, /* middot */
+	{ 13602, 4, "\360\235\223\207" }, /* rscr */
+	{ 8058, 4, "\342\247\266" }, /* dsol */
+	{ 5918, 8, "\342\246\250" }, /* angmsdaa */
+	{ 0, 0, "" },
+	{ 1987, 6, "\304\271" }, /* Lacute */
+	{ 11162, 7, "\342\231\256" }, /* natural */
+	{ 0, 0, "" },
+	{ 8345, 6, "\342\211\226" }, /* eqcirc */
+	{ 8099, 7, "\342\246\246" }, /* dwangle */
+	{ 13979, 7, "\342\250\244" }, /* simplus */
+	{ 0, 0, "" },
+	{ 7334, 10, "\342\210\201" }, /* complement */
+	{ 0, 0, "" },
+	{ 9593, 5, "\304\265" }, /* jcirc */
+	{ 4773, 18, "\342\212\223" }, /* SquareIntersection */
+	{ 214, 20, "\342\205\205" }, /* CapitalDifferentialD */
+	{ 0, 0, "" },
+	{ 4658, 6, "\305\236" }, /* Scedil */
+	{ 5613, 5, "\305\264" }, /* Wcirc */
+	{ 14092, 9, "\342\231\240" }, /* spadesuit */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 1740, 4, "\320\201" }, /* IOcy */
+	{ 12192, 4, "\342\212\231" }, /* odot */
+	{ 11262, 5, "\342\206\227" }, /* nearr */
+	{ 9066, 6, "\342\211\263" }, /* gtrsim */
+	{ 0, 0, "" },
+	{ 12204, 5, "\305\223" }, /* oelig */
+	{ 6206, 6, "\342\214\205" }, /* barwed */
+	{ 15892, 5, "\342\237\272" }, /* xhArr */
+	{ 11043, 10, "\342\207\215" }, /* nLeftarrow */
+	{ 8862, 6, "\342\252\224" }, /* gesles */
+	{ 12301, 4, "\342\246\266" }, /* omid */
+	{ 7757, 5, "\316\264" }, /* delta */
+	{ 0, 0, "" },
+	{ 5483, 4, "\342\253\253" }, /* Vbar */
+	{ 1706, 12, "\342\211\216" }, /* HumpDownHump */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 7200, 8, "\342\223\210" }, /* circledS */
+	{ 7547, 11, "\342\213\236" }, /* curlyeqprec */
+	{ 8651, 6, "\342\205\231" }, /* frac16 */
+	{ 1752, 5, "\303\216" }, /* Icirc */
+	{ 0, 0, "" },
+	{ 4606, 3, "\342\206\261" }, /* Rsh */
+	{ 0, 0, "" },
+	{ 13589, 5, "\342\207\211" }, /* rrarr */
+	{ 4959, 8, "\342\210\213" }, /* SuchThat */
+	{ 5465, 6, "\305\250" }, /* Utilde */
+	{ 11376, 5, "\342\206\256" }, /* nharr */
+	{ 15467, 4, "\303\274" }, /* uuml */
+	{ 6288, 4, "\316\262" }, /* beta */
+	{ 13848, 4, "\342\234\266" }, /* sext */
+	{ 9495, 4, "\321\221" }, /* iocy */
+	{ 3764, 6, "\305\220" }, /* Odblac */
+	{ 14390, 9, "\342\212\212" }, /* subsetneq */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 5844, 5, "\316\261" }, /* alpha */
+	{ 126, 4, "\342\253\247" }, /* Barv */
+	{ 471, 31, "\342\210\263" }, /* CounterClockwiseContourIntegral */
+	{ 0, 0, "" },
+	{ 8827, 5, "\342\252\251" }, /* gescc */
+	{ 0, 0, "" },
+	{ 3760, 3, "\320\236" }, /* Ocy */
+	{ 7663, 4, "\342\207\223" }, /* dArr */
+	{ 9184, 8, "\342\244\245" }, /* hksearow */
+	{ 13611, 4, "\135" }, /* rsqb */
+	{ 9924, 6, "\304\274" }, /* lcedil */
+	{ 0, 0, "" },
+	{ 1798, 7, "\342\207\222" }, /* Implies */
+	{ 5651, 4, "\360\235\222\263" }, /* Xscr */
+	{ 12991, 8, "\342\246\263" }, /* raemptyv */
+	{ 8462, 4, "\303\253" }, /* euml */
+	{ 2718, 4, "\342\204\263" }, /* Mscr */
+	{ 3944, 2, "\316\240" }, /* Pi */
+	{ 3273, 12, "\342\211\264" }, /* NotLessTilde */
+	{ 138, 3, "\320\221" }, /* Bcy */
+	{ 16093, 3, "\360\235\224\267" }, /* zfr */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 10997, 2, "\342\210\223" }, /* mp */
+	{ 6150, 8, "\342\211\214" }, /* backcong */
+	{ 11070, 3, "\342\213\230\314\270" }, /* nLl */
+	{ 11926, 6, "\303\261" }, /* ntilde */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 12051, 4, "\076\342\203\222" }, /* nvgt */
+	{ 7500, 6, "\342\251\206" }, /* cupcap */
+	{ 2673, 3, "\320\234" }, /* Mcy */
+	{ 1883, 6, "\304\250" }, /* Itilde */
+	{ 0, 0, "" },
+	{ 2614, 4, "\360\235\225\203" }, /* Lopf */
+	{ 14783, 9, "\342\210\264" }, /* therefore */
+	{ 0, 0, "" },
+	{ 12180, 6, "\305\221" }, /* odblac */
+	{ 7405, 5, "\342\234\227" }, /* cross */
+	{ 542, 4, "\320\205" }, /* DScy */
+	{ 12104, 5, "\342\210\274\342\203\222" }, /* nvsim */
+	{ 692, 13, "\342\205\206" }, /* DifferentialD */
+	{ 11156, 5, "\342\231\256" }, /* natur */
+	{ 5643, 2, "\316\236" }, /* Xi */
+	{ 11102, 6, "\342\212\256" }, /* nVdash */
+	{ 0, 0, "" },
+	{ 1878, 4, "\342\204\220" }, /* Iscr */
+	{ 0, 0, "" },
+	{ 1679, 14, "\342\224\200" }, /* HorizontalLine */
+	{ 6281, 6, "\342\204\254" }, /* bernou */
+	{ 12384, 7, "\342\251\227" }, /* orslope */
+	{ 7571, 8, "\342\213\216" }, /* curlyvee */
+	{ 0, 0, "" },
+	{ 12281, 5, "\305\215" }, /* omacr */
+	{ 2057, 9, "\342\206\220" }, /* LeftArrow */
+	{ 8540, 5, "\357\254\200" }, /* fflig */
+	{ 0, 0, "" },
+	{ 7514, 6, "\342\212\215" }, /* cupdot */
+	{ 2001, 4, "\342\237\252" }, /* Lang */
+	{ 7728, 2, "\342\205\206" }, /* dd */
+	{ 2377, 13, "\342\245\222" }, /* LeftVectorBar */
+	{ 15877, 4, "\342\213\203" }, /* xcup */
+	{ 9244, 4, "\360\235\225\231" }, /* hopf */
+	{ 6976, 3, "\342\210\251" }, /* cap */
+	{ 1211, 6, "\304\232" }, /* Ecaron */
+	{ 0, 0, "" },
+	{ 14881, 8, "\342\250\261" }, /* timesbar */
+	{ 0, 0, "" },
+	{ 3877, 7, "\342\200\276" }, /* OverBar */
+	{ 0, 0, "" },
+	{ 9249, 6, "\342\200\225" }, /* horbar */
+	{ 9338, 6, "\342\250\214" }, /* iiiint */
+	{ 0, 0, "" },
+	{ 7539, 7, "\342\244\274" }, /* curarrm */
+	{ 372, 21, "\342\200\235" }, /* CloseCurlyDoubleQuote */
+	{ 3771, 3, "\360\235\224\222" }, /* Ofr */
+	{ 14001, 13, "\342\210\226" }, /* smallsetminus */
+	{ 10381, 4, "\342\252\211" }, /* lnap */
+	{ 8546, 6, "\357\254\204" }, /* ffllig */
+	{ 4237, 10, "\342\206\222" }, /* RightArrow */
+	{ 6661, 5, "\342\225\232" }, /* boxUR */
+	{ 14155, 10, "\342\212\221" }, /* sqsubseteq */
+	{ 15694, 6, "\342\212\273" }, /* veebar */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 14259, 5, "\342\230\205" }, /* starf */
+	{ 537, 4, "\320\202" }, /* DJcy */
+	{ 423, 9, "\342\211\241" }, /* Congruent */
+	{ 1196, 3, "\305\212" }, /* ENG */
+	{ 4858, 11, "\342\212\224" }, /* SquareUnion */
+	{ 0, 0, "" },
+	{ 67, 4, "\360\235\224\270" }, /* Aopf */
+	{ 0, 0, "" },
+	{ 12560, 3, "\317\226" }, /* piv */
+	{ 10978, 6, "\342\210\223" }, /* mnplus */
+	{ 4111, 6, "\305\224" }, /* Racute */
+	{ 4035, 5, "\342\200\263" }, /* Prime */
+	{ 5460, 4, "\360\235\222\260" }, /* Uscr */
+	{ 15262, 6, "\342\214\234" }, /* ulcorn */
+	{ 12811, 8, "\342\214\256" }, /* profalar */
+	{ 15320, 11, "\342\206\225" }, /* updownarrow */
+	{ 13680, 6, "\305\233" }, /* sacute */
+	{ 13762, 5, "\342\211\277" }, /* scsim */
+	{ 312, 11, "\342\212\226" }, /* CircleMinus */
+	{ 15726, 3, "\360\235\224\263" }, /* vfr */
+	{ 8714, 6, "\342\205\235" }, /* frac58 */
+	{ 2163, 17, "\342\245\231" }, /* LeftDownVectorBar */
+	{ 7427, 4, "\342\253\220" }, /* csup */
+	{ 10843, 10, "\342\206\244" }, /* mapstoleft */
+	{ 4985, 13, "\342\212\207" }, /* SupersetEqual */
+	{ 5830, 7, "\342\204\265" }, /* alefsym */
+	{ 0, 0, "" },
+	{ 6236, 5, "\342\211\214" }, /* bcong */
+	{ 12027, 6, "\342\244\204" }, /* nvHarr */
+	{ 11078, 4, "\342\211\252\314\270" }, /* nLtv */
+	{ 4622, 6, "\320\251" }, /* SHCHcy */
+	{ 0, 0, "" },
+	{ 6969, 6, "\304\207" }, /* cacute */
+	{ 12236, 5, "\342\246\265" }, /* ohbar */
+	{ 12071, 4, "\342\211\244\342\203\222" }, /* nvle */
+	{ 15432, 4, "\360\235\223\212" }, /* uscr */
+	{ 5347, 11, "\342\206\225" }, /* UpDownArrow */
+	{ 10174, 6, "\342\251\277" }, /* lesdot */
+	{ 15848, 2, "\342\204\230" }, /* wp */
+	{ 0, 0, "" },
+	{ 14133, 5, "\342\212\217" }, /* sqsub */
+	{ 6938, 6, "\342\200\242" }, /* bullet */
+	{ 11131, 4, "\342\251\260\314\270" }, /* napE */
+	{ 13962, 4, "\342\252\235" }, /* siml */
+	{ 8360, 5, "\342\211\202" }, /* eqsim */
+	{ 8196, 6, "\303\250" }, /* egrave */
+	{ 7079, 5, "\302\270" }, /* cedil */
+	{ 9636, 5, "\316\272" }, /* kappa */
+	{ 14046, 4, "\342\252\254" }, /* smte */
+	{ 14064, 3, "\057" }, /* sol */
+	{ 6950, 5, "\342\252\256" }, /* bumpE */
+	{ 5726, 3, "\320\227" }, /* Zcy */
+	{ 12606, 7, "\342\250\242" }, /* pluscir */
+	{ 14166, 5, "\342\212\220" }, /* sqsup */
+	{ 1218, 5, "\303\212" }, /* Ecirc */
+	{ 3726, 4, "\360\235\222\251" }, /* Nscr */
+	{ 1651, 5, "\304\244" }, /* Hcirc */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 6415, 6, "\342\213\201" }, /* bigvee */
+	{ 0, 0, "" },
+	{ 13518, 5, "\342\253\256" }, /* rnmid */
+	{ 8281, 6, "\342\200\205" }, /* emsp14 */
+	{ 8886, 4, "\321\223" }, /* gjcy */
+	{ 11769, 4, "\342\211\201" }, /* nsim */
+	{ 1081, 17, "\342\245\226" }, /* DownLeftVectorBar */
+	{ 12534, 6, "\342\204\263" }, /* phmmat */
+	{ 0, 0, "" },
+	{ 12702, 4, "\342\211\272" }, /* prec */
+	{ 8081, 5, "\342\226\276" }, /* dtrif */
+	{ 11334, 5, "\342\211\247\314\270" }, /* ngeqq */
+	{ 14760, 4, "\342\203\233" }, /* tdot */
+	{ 12335, 2, "\342\210\250" }, /* or */
+	{ 0, 0, "" },
+	{ 3747, 6, "\303\223" }, /* Oacute */
+	{ 15791, 6, "\342\212\213\357\270\200" }, /* vsupne */
+	{ 0, 0, "" },
+	{ 9100, 4, "\302\275" }, /* half */
+	{ 0, 0, "" },
+	{ 10736, 6, "\342\246\226" }, /* ltrPar */
+	{ 5990, 5, "\342\210\237" }, /* angrt */
+	{ 2433, 13, "\342\211\246" }, /* LessFullEqual */
+	{ 1344, 4, "\342\204\260" }, /* Escr */
+	{ 9275, 6, "\342\201\203" }, /* hybull */
+	{ 6359, 8, "\342\250\206" }, /* bigsqcup */
+	{ 0, 0, "" },
+	{ 12883, 4, "\342\250\214" }, /* qint */
+	{ 8644, 6, "\342\205\225" }, /* frac15 */
+	{ 10155, 8, "\342\251\275" }, /* leqslant */
+	{ 4078, 3, "\316\250" }, /* Psi */
+	{ 6259, 7, "\342\210\265" }, /* because */
+	{ 0, 0, "" },
+	{ 9093, 6, "\342\200\212" }, /* hairsp */
+	{ 14918, 6, "\342\253\261" }, /* topcir */
+	{ 2080, 19, "\342\207\206" }, /* LeftArrowRightArrow */
+	{ 0, 0, "" },
+	{ 14210, 6, "\342\226\252" }, /* squarf */
+	{ 8352, 7, "\342\211\225" }, /* eqcolon */
+	{ 0, 0, "" },
+	{ 13826, 6, "\342\244\251" }, /* seswar */
+	{ 12441, 5, "\342\214\275" }, /* ovbar */
+	{ 0, 0, "" },
+	{ 12888, 4, "\360\235\225\242" }, /* qopf */
+	{ 2401, 14, "\342\207\224" }, /* Leftrightarrow */
+	{ 0, 0, "" },
+	{ 585, 5, "\316\224" }, /* Delta */
+	{ 0, 0, "" },
+	{ 1969, 4, "\360\235\225\202" }, /* Kopf */
+	{ 8288, 3, "\305\213" }, /* eng */
+	{ 13174, 7, "\342\246\220" }, /* rbrkslu */
+	{ 10832, 10, "\342\206\247" }, /* mapstodown */
+	{ 4651, 6, "\305\240" }, /* Scaron */
+	{ 14460, 6, "\342\252\260" }, /* succeq */
+	{ 9215, 13, "\342\206\251" }, /* hookleftarrow */
+	{ 8107, 4, "\321\237" }, /* dzcy */
+	{ 8563, 5, "\146\152" }, /* fjlig */
+	{ 514, 3, "\342\213\223" }, /* Cup */
+	{ 5783, 2, "\342\210\276" }, /* ac */
+	{ 15114, 6, "\305\247" }, /* tstrok */
+	{ 10748, 5, "\342\212\264" }, /* ltrie */
+	{ 8153, 4, "\342\211\226" }, /* ecir */
+	{ 13275, 3, "\302\256" }, /* reg */
+	{ 14849, 6, "\342\210\274" }, /* thksim */
+	{ 2930, 9, "\342\211\255" }, /* NotCupCap */
+	{ 8880, 5, "\342\204\267" }, /* gimel */
+	{ 14862, 5, "\313\234" }, /* tilde */
+	{ 6089, 5, "\303\245" }, /* aring */
+	{ 8241, 5, "\304\223" }, /* emacr */
+	{ 6556, 5, "\342\226\210" }, /* block */
+	{ 577, 3, "\320\224" }, /* Dcy */
+	{ 12451, 4, "\302\266" }, /* para */
+	{ 6865, 5, "\342\224\234" }, /* boxvr */
+	{ 4123, 4, "\342\206\240" }, /* Rarr */
+	{ 9642, 6, "\317\260" }, /* kappav */
+	{ 10448, 18, "\342\237\267" }, /* longleftrightarrow */
+	{ 1641, 5, "\313\207" }, /* Hacek */
+	{ 15742, 5, "\342\212\203\342\203\222" }, /* vnsup */
+	{ 4792, 12, "\342\212\217" }, /* SquareSubset */
+	{ 12547, 2, "\317\200" }, /* pi */
+	{ 3940, 3, "\316\246" }, /* Phi */
+	{ 0, 0, "" },
+	{ 9358, 5, "\342\204\251" }, /* iiota */
+	{ 15301, 5, "\305\263" }, /* uogon */
+	{ 14672, 6, "\342\253\224" }, /* supsub */
+	{ 1018, 9, "\314\221" }, /* DownBreve */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 8978, 2, "\076" }, /* gt */
+	{ 8203, 3, "\342\252\226" }, /* egs */
+	{ 0, 0, "" },
+	{ 14299, 3, "\342\212\202" }, /* sub */
+	{ 0, 0, "" },
+	{ 11826, 5, "\342\212\210" }, /* nsube */
+	{ 15404, 8, "\342\214\235" }, /* urcorner */
+	{ 16033, 4, "\321\227" }, /* yicy */
+	{ 10250, 7, "\342\211\266" }, /* lessgtr */
+	{ 0, 0, "" },
+	{ 15861, 4, "\360\235\223\214" }, /* wscr */
+	{ 15748, 4, "\360\235\225\247" }, /* vopf */
+	{ 10507, 14, "\342\206\254" }, /* looparrowright */
+	{ 12154, 4, "\342\212\233" }, /* oast */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 1819, 12, "\342\213\202" }, /* Intersection */
+	{ 12232, 3, "\342\247\201" }, /* ogt */
+	{ 11054, 15, "\342\207\216" }, /* nLeftrightarrow */
+	{ 5794, 5, "\303\242" }, /* acirc */
+	{ 8326, 4, "\316\265" }, /* epsi */
+	{ 7133, 3, "\317\207" }, /* chi */
+	{ 15167, 4, "\342\245\243" }, /* uHar */
+	{ 0, 0, "" },
+	{ 13146, 6, "\175" }, /* rbrace */
+	{ 8658, 6, "\342\205\233" }, /* frac18 */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 4431, 16, "\342\247\220" }, /* RightTriangleBar */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 5911, 6, "\342\210\241" }, /* angmsd */
+	{ 10701, 5, "\342\213\226" }, /* ltdot */
+	{ 10579, 4, "\050" }, /* lpar */
+	{ 14328, 7, "\342\253\201" }, /* submult */
+	{ 9420, 6, "\342\204\205" }, /* incare */
+	{ 13279, 6, "\342\245\275" }, /* rfisht */
+	{ 7141, 4, "\342\247\203" }, /* cirE */
+	{ 0, 0, "" },
+	{ 12793, 5, "\342\252\271" }, /* prnap */
+	{ 6013, 6, "\342\210\242" }, /* angsph */
+	{ 9722, 4, "\342\245\242" }, /* lHar */
+	{ 16029, 3, "\360\235\224\266" }, /* yfr */
+	{ 15647, 15, "\342\212\262" }, /* vartriangleleft */
+	{ 6841, 5, "\342\225\241" }, /* boxvL */
+	{ 0, 0, "" },
+	{ 8574, 5, "\357\254\202" }, /* fllig */
+	{ 9345, 5, "\342\210\255" }, /* iiint */
+	{ 15638, 8, "\317\221" }, /* vartheta */
+	{ 12829, 8, "\342\214\223" }, /* profsurf */
+	{ 2908, 4, "\342\204\225" }, /* Nopf */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 8789, 3, "\320\263" }, /* gcy */
+	{ 0, 0, "" },
+	{ 14432, 4, "\342\211\273" }, /* succ */
+	{ 14733, 3, "\317\204" }, /* tau */
+	{ 8183, 5, "\342\211\222" }, /* efDot */
+	{ 9951, 5, "\342\200\234" }, /* ldquo */
+	{ 0, 0, "" },
+	{ 9268, 6, "\304\247" }, /* hstrok */
+	{ 4823, 14, "\342\212\220" }, /* SquareSuperset */
+	{ 3885, 9, "\342\217\236" }, /* OverBrace */
+	{ 9818, 6, "\342\206\253" }, /* larrlp */
+	{ 1066, 14, "\342\206\275" }, /* DownLeftVector */
+	{ 0, 0, "" },
+	{ 5546, 17, "\342\235\230" }, /* VerticalSeparator */
+	{ 14590, 7, "\342\253\202" }, /* supmult */
+	{ 0, 0, "" },
+	{ 2883, 7, "\342\201\240" }, /* NoBreak */
+	{ 13660, 8, "\342\247\216" }, /* rtriltri */
+	{ 6690, 5, "\342\225\243" }, /* boxVL */
+	{ 8933, 5, "\342\211\251" }, /* gneqq */
+	{ 12571, 7, "\342\204\216" }, /* planckh */
+	{ 10229, 9, "\342\213\232" }, /* lesseqgtr */
+	{ 14085, 6, "\342\231\240" }, /* spades */
+	{ 0, 0, "" },
+	{ 416, 6, "\342\251\264" }, /* Colone */
+	{ 7807, 11, "\342\231\246" }, /* diamondsuit */
+	{ 10324, 5, "\342\207\207" }, /* llarr */
+	{ 2017, 4, "\342\206\236" }, /* Larr */
+	{ 7967, 9, "\342\206\223" }, /* downarrow */
+	{ 8477, 5, "\342\210\203" }, /* exist */
+	{ 5850, 5, "\304\201" }, /* amacr */
+	{ 0, 0, "" },
+	{ 14874, 6, "\342\212\240" }, /* timesb */
+	{ 12478, 4, "\342\210\202" }, /* part */
+	{ 896, 16, "\342\207\222" }, /* DoubleRightArrow */
+	{ 0, 0, "" },
+	{ 456, 4, "\342\204\202" }, /* Copf */
+	{ 7906, 3, "\313\231" }, /* dot */
+	{ 14509, 4, "\342\231\252" }, /* sung */
+	{ 5210, 6, "\305\260" }, /* Udblac */
+	{ 12007, 6, "\342\204\226" }, /* numero */
+	{ 6933, 4, "\342\200\242" }, /* bull */
+	{ 8950, 5, "\140" }, /* grave */
+	{ 3957, 13, "\342\204\214" }, /* Poincareplane */
+	{ 5217, 3, "\360\235\224\230" }, /* Ufr */
+	{ 6451, 11, "\342\226\252" }, /* blacksquare */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 9376, 5, "\342\204\221" }, /* image */
+	{ 13783, 5, "\342\251\246" }, /* sdote */
+	{ 11787, 5, "\342\210\244" }, /* nsmid */
+	{ 0, 0, "" },
+	{ 9193, 8, "\342\244\246" }, /* hkswarow */
+	{ 198, 4, "\302\251" }, /* COPY */
+	{ 4738, 5, "\316\243" }, /* Sigma */
+	{ 9166, 6, "\342\200\246" }, /* hellip */
+	{ 9173, 6, "\342\212\271" }, /* hercon */
+	{ 15812, 6, "\342\251\237" }, /* wedbar */
+	{ 11395, 4, "\342\213\272" }, /* nisd */
+	{ 13024, 5, "\302\273" }, /* raquo */
+	{ 0, 0, "" },
+	{ 61, 5, "\304\204" }, /* Aogon */
+	{ 1595, 17, "\342\251\276" }, /* GreaterSlantEqual */
+	{ 8553, 3, "\360\235\224\243" }, /* ffr */
+	{ 5454, 5, "\305\256" }, /* Uring */
+	{ 4091, 4, "\342\204\232" }, /* Qopf */
+	{ 410, 5, "\342\210\267" }, /* Colon */
+	{ 6340, 8, "\342\250\201" }, /* bigoplus */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 30, 3, "\320\220" }, /* Acy */
+	{ 4096, 4, "\360\235\222\254" }, /* Qscr */
+	{ 0, 0, "" },
+	{ 13237, 4, "\342\206\263" }, /* rdsh */
+	{ 667, 16, "\313\234" }, /* DiacriticalTilde */
+	{ 13207, 3, "\321\200" }, /* rcy */
+	{ 12968, 4, "\342\245\244" }, /* rHar */
+	{ 2468, 14, "\342\251\275" }, /* LessSlantEqual */
+	{ 2756, 19, "\342\200\213" }, /* NegativeMediumSpace */
+	{ 5790, 3, "\342\210\277" }, /* acd */
+	{ 13607, 3, "\342\206\261" }, /* rsh */
+	{ 7656, 6, "\342\214\255" }, /* cylcty */
+	{ 8292, 4, "\342\200\202" }, /* ensp */
+	{ 0, 0, "" },
+	{ 9149, 6, "\342\231\245" }, /* hearts */
+	{ 1868, 4, "\360\235\225\200" }, /* Iopf */
+	{ 13383, 15, "\342\207\204" }, /* rightleftarrows */
+	{ 0, 0, "" },
+	{ 6871, 6, "\342\200\265" }, /* bprime */
+	{ 1771, 6, "\303\214" }, /* Igrave */
+	{ 4171, 18, "\342\207\213" }, /* ReverseEquilibrium */
+	{ 12020, 6, "\342\212\255" }, /* nvDash */
+	{ 0, 0, "" },
+	{ 14634, 9, "\342\253\206" }, /* supseteqq */
+	{ 0, 0, "" },
+	{ 12843, 6, "\342\210\235" }, /* propto */
+	{ 11952, 15, "\342\213\254" }, /* ntrianglelefteq */
+	{ 12123, 5, "\342\206\226" }, /* nwarr */
+	{ 10803, 4, "\342\231\202" }, /* male */
+	{ 9957, 6, "\342\200\236" }, /* ldquor */
+	{ 9320, 3, "\342\207\224" }, /* iff */
+	{ 11568, 7, "\342\213\266" }, /* notinvc */
+	{ 9005, 7, "\342\251\274" }, /* gtquest */
+	{ 9681, 4, "\360\235\225\234" }, /* kopf */
+	{ 11202, 6, "\305\210" }, /* ncaron */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 12872, 6, "\342\200\210" }, /* puncsp */
+	{ 11482, 4, "\342\251\275\314\270" }, /* nles */
+	{ 0, 0, "" },
+	{ 9917, 6, "\304\276" }, /* lcaron */
+	{ 0, 0, "" },
+	{ 6762, 5, "\342\225\250" }, /* boxhU */
+	{ 15819, 5, "\342\210\247" }, /* wedge */
+	{ 1354, 3, "\316\227" }, /* Eta */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 6550, 5, "\342\226\223" }, /* blk34 */
+	{ 8472, 4, "\041" }, /* excl */
+	{ 12614, 6, "\342\210\224" }, /* plusdo */
+	{ 3414, 19, "\342\247\220\314\270" }, /* NotRightTriangleBar */
+	{ 5816, 2, "\342\201\241" }, /* af */
+	{ 0, 0, "" },
+	{ 7598, 14, "\342\206\266" }, /* curvearrowleft */
+	{ 11109, 5, "\342\210\207" }, /* nabla */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 9073, 9, "\342\211\251\357\270\200" }, /* gvertneqq */
+	{ 1896, 4, "\303\217" }, /* Iuml */
+	{ 6495, 17, "\342\227\202" }, /* blacktriangleleft */
+	{ 1358, 4, "\303\213" }, /* Euml */
+	{ 8303, 4, "\360\235\225\226" }, /* eopf */
+	{ 14315, 4, "\342\212\206" }, /* sube */
+	{ 13700, 4, "\342\252\270" }, /* scap */
+	{ 7479, 7, "\342\244\275" }, /* cularrp */
+	{ 2738, 6, "\305\207" }, /* Ncaron */
+	{ 1890, 5, "\320\206" }, /* Iukcy */
+	{ 7868, 6, "\342\213\207" }, /* divonx */
+	{ 15882, 5, "\342\226\275" }, /* xdtri */
+	{ 0, 0, "" },
+	{ 9811, 6, "\342\206\251" }, /* larrhk */
+	{ 14965, 12, "\342\226\277" }, /* triangledown */
+	{ 1862, 5, "\304\256" }, /* Iogon */
+	{ 0, 0, "" },
+	{ 9832, 7, "\342\245\263" }, /* larrsim */
+	{ 14836, 6, "\342\200\211" }, /* thinsp */
+	{ 6907, 5, "\342\213\215" }, /* bsime */
+	{ 11938, 13, "\342\213\252" }, /* ntriangleleft */
+	{ 2731, 6, "\305\203" }, /* Nacute */
+	{ 0, 0, "" },
+	{ 6532, 5, "\342\220\243" }, /* blank */
+	{ 1694, 4, "\342\204\213" }, /* Hscr */
+	{ 2566, 13, "\342\237\270" }, /* Longleftarrow */
+	{ 7054, 5, "\304\211" }, /* ccirc */
+	{ 11268, 7, "\342\206\227" }, /* nearrow */
+	{ 14713, 6, "\342\244\252" }, /* swnwar */
+	{ 5862, 3, "\046" }, /* amp */
+	{ 14644, 9, "\342\212\213" }, /* supsetneq */
+	{ 14247, 6, "\342\213\206" }, /* sstarf */
+	{ 9881, 6, "\173" }, /* lbrace */
+	{ 8377, 11, "\342\252\225" }, /* eqslantless */
+	{ 11933, 4, "\342\211\270" }, /* ntlg */
+	{ 14348, 7, "\342\252\277" }, /* subplus */
+	{ 5671, 6, "\303\235" }, /* Yacute */
+	{ 15529, 10, "\342\210\205" }, /* varnothing */
+	{ 6562, 3, "\075\342\203\245" }, /* bne */
+	{ 3828, 14, "\342\200\230" }, /* OpenCurlyQuote */
+	{ 0, 0, "" },
+	{ 5488, 3, "\320\222" }, /* Vcy */
+	{ 4082, 4, "\042" }, /* QUOT */
+	{ 9453, 6, "\342\212\272" }, /* intcal */
+	{ 14868, 5, "\303\227" }, /* times */
+	{ 0, 0, "" },
+	{ 10650, 5, "\342\252\215" }, /* lsime */
+	{ 0, 0, "" },
+	{ 7491, 8, "\342\251\210" }, /* cupbrcap */
+	{ 6252, 6, "\342\210\265" }, /* becaus */
+	{ 706, 4, "\360\235\224\273" }, /* Dopf */
+	{ 6513, 18, "\342\226\270" }, /* blacktriangleright */
+	{ 7265, 7, "\342\247\202" }, /* cirscir */
+	{ 0, 0, "" },
+	{ 12257, 5, "\342\246\276" }, /* olcir */
+	{ 7527, 4, "\342\210\252\357\270\200" }, /* cups */
+	{ 10352, 6, "\305\200" }, /* lmidot */
+	{ 0, 0, "" },
+	{ 2067, 12, "\342\207\244" }, /* LeftArrowBar */
+	{ 5800, 5, "\302\264" }, /* acute */
+	{ 5719, 6, "\305\275" }, /* Zcaron */
+	{ 5927, 8, "\342\246\251" }, /* angmsdab */
+	{ 0, 0, "" },
+	{ 10667, 5, "\342\200\230" }, /* lsquo */
+	{ 0, 0, "" },
+	{ 5981, 8, "\342\246\257" }, /* angmsdah */
+	{ 4766, 6, "\342\226\241" }, /* Square */
+	{ 11024, 5, "\342\212\270" }, /* mumap */
+	{ 13718, 3, "\342\252\260" }, /* sce */
+	{ 12081, 7, "\342\212\264\342\203\222" }, /* nvltrie */
+	{ 5578, 13, "\342\200\212" }, /* VeryThinSpace */
+	{ 12600, 5, "\342\212\236" }, /* plusb */
+	{ 581, 3, "\342\210\207" }, /* Del */
+	{ 12944, 5, "\342\207\233" }, /* rAarr */
+	{ 9901, 7, "\342\246\217" }, /* lbrksld */
+	{ 6242, 3, "\320\261" }, /* bcy */
+	{ 0, 0, "" },
+	{ 11530, 5, "\342\210\211" }, /* notin */
+	{ 4870, 4, "\360\235\222\256" }, /* Sscr */
+	{ 8873, 2, "\342\211\253" }, /* gg */
+	{ 9909, 7, "\342\246\215" }, /* lbrkslu */
+	{ 8171, 3, "\321\215" }, /* ecy */
+	{ 12362, 4, "\302\252" }, /* ordf */
+	{ 14057, 6, "\321\214" }, /* softcy */
+	{ 461, 9, "\342\210\220" }, /* Coproduct */
+	{ 9875, 5, "\342\235\262" }, /* lbbrk */
+	{ 8230, 3, "\342\252\225" }, /* els */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 9790, 5, "\342\207\244" }, /* larrb */
+	{ 8533, 6, "\357\254\203" }, /* ffilig */
+	{ 14042, 3, "\342\252\252" }, /* smt */
+	{ 12917, 7, "\342\250\226" }, /* quatint */
+	{ 15016, 13, "\342\226\271" }, /* triangleright */
+	{ 4314, 18, "\342\245\235" }, /* RightDownTeeVector */
+	{ 12641, 7, "\342\250\246" }, /* plussim */
+	{ 1911, 3, "\360\235\224\215" }, /* Jfr */
+	{ 14203, 6, "\342\226\241" }, /* square */
+	{ 7847, 6, "\303\267" }, /* divide */
+	{ 5441, 4, "\317\222" }, /* Upsi */
+	{ 12962, 5, "\342\244\217" }, /* rBarr */
+	{ 13842, 5, "\342\210\226" }, /* setmn */
+	{ 9946, 4, "\342\244\266" }, /* ldca */
+	{ 0, 0, "" },
+	{ 3340, 16, "\342\252\257\314\270" }, /* NotPrecedesEqual */
+	{ 13224, 5, "\342\200\235" }, /* rdquo */
+	{ 8939, 5, "\342\213\247" }, /* gnsim */
+	{ 4388, 13, "\342\206\246" }, /* RightTeeArrow */
+	{ 0, 0, "" },
+	{ 14233, 6, "\342\210\226" }, /* ssetmn */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 15866, 4, "\342\213\202" }, /* xcap */
+	{ 15684, 5, "\342\212\242" }, /* vdash */
+	{ 10825, 6, "\342\206\246" }, /* mapsto */
+	{ 0, 0, "" },
+	{ 7309, 5, "\054" }, /* comma */
+	{ 14742, 6, "\305\245" }, /* tcaron */
+	{ 6853, 5, "\342\224\274" }, /* boxvh */
+	{ 10428, 5, "\342\237\246" }, /* lobrk */
+	{ 5206, 3, "\320\243" }, /* Ucy */
+	{ 11642, 3, "\342\212\200" }, /* npr */
+	{ 0, 0, "" },
+	{ 559, 4, "\342\206\241" }, /* Darr */
+	{ 0, 0, "" },
+	{ 7074, 4, "\304\213" }, /* cdot */
+	{ 10574, 4, "\342\247\253" }, /* lozf */
+	{ 0, 0, "" },
+	{ 14991, 14, "\342\212\264" }, /* trianglelefteq */
+	{ 2666, 2, "\342\211\252" }, /* Lt */
+	{ 1224, 3, "\320\255" }, /* Ecy */
+	{ 627, 22, "\313\235" }, /* DiacriticalDoubleAcute */
+	{ 2961, 10, "\342\210\211" }, /* NotElement */
+	{ 9630, 5, "\321\224" }, /* jukcy */
+	{ 2713, 4, "\360\235\225\204" }, /* Mopf */
+	{ 0, 0, "" },
+	{ 10399, 4, "\342\252\207" }, /* lneq */
+	{ 7034, 5, "\342\251\215" }, /* ccaps */
+	{ 0, 0, "" },
+	{ 13795, 6, "\342\244\245" }, /* searhk */
+	{ 8693, 6, "\342\205\234" }, /* frac38 */
+	{ 13768, 3, "\321\201" }, /* scy */
+	{ 9702, 6, "\342\244\233" }, /* lAtail */
+	{ 6293, 4, "\342\204\266" }, /* beth */
+	{ 0, 0, "" },
+	{ 525, 2, "\342\205\205" }, /* DD */
+	{ 6349, 9, "\342\250\202" }, /* bigotimes */
+	{ 2659, 6, "\305\201" }, /* Lstrok */
+	{ 8740, 4, "\360\235\222\273" }, /* fscr */
+	{ 10280, 3, "\360\235\224\251" }, /* lfr */
+	{ 15127, 16, "\342\206\236" }, /* twoheadleftarrow */
+	{ 6655, 5, "\342\225\235" }, /* boxUL */
+	{ 0, 0, "" },
+	{ 6896, 5, "\342\201\217" }, /* bsemi */
+	{ 13945, 5, "\342\211\203" }, /* simeq */
+	{ 7392, 6, "\342\204\227" }, /* copysr */
+	{ 9559, 6, "\342\213\263" }, /* isinsv */
+	{ 14320, 7, "\342\253\203" }, /* subedot */
+	{ 4675, 3, "\360\235\224\226" }, /* Sfr */
+	{ 0, 0, "" },
+	{ 13202, 4, "\175" }, /* rcub */
+	{ 14538, 6, "\342\252\276" }, /* supdot */
+	{ 8247, 5, "\342\210\205" }, /* empty */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 12170, 3, "\320\276" }, /* ocy */
+	{ 795, 20, "\342\207\224" }, /* DoubleLeftRightArrow */
+	{ 51, 5, "\304\200" }, /* Amacr */
+	{ 4629, 4, "\320\250" }, /* SHcy */
+	{ 0, 0, "" },
+	{ 13005, 5, "\342\246\222" }, /* rangd */
+	{ 0, 0, "" },
+	{ 2891, 16, "\302\240" }, /* NonBreakingSpace */
+	{ 7191, 8, "\302\256" }, /* circledR */
+	{ 4118, 4, "\342\237\253" }, /* Rang */
+	{ 13580, 8, "\342\250\222" }, /* rppolint */
+	{ 1626, 4, "\360\235\222\242" }, /* Gscr */
+	{ 5856, 5, "\342\250\277" }, /* amalg */
+	{ 14943, 6, "\342\200\264" }, /* tprime */
+	{ 10619, 3, "\342\200\216" }, /* lrm */
+	{ 15144, 17, "\342\206\240" }, /* twoheadrightarrow */
+	{ 2181, 9, "\342\214\212" }, /* LeftFloor */
+	{ 5102, 10, "\342\211\203" }, /* TildeEqual */
+	{ 2270, 15, "\342\247\217" }, /* LeftTriangleBar */
+	{ 13507, 10, "\342\216\261" }, /* rmoustache */
+	{ 7521, 5, "\342\251\205" }, /* cupor */
+	{ 0, 0, "" },
+	{ 15798, 7, "\342\246\232" }, /* vzigzag */
+	{ 10566, 7, "\342\227\212" }, /* lozenge */
+	{ 11083, 11, "\342\207\217" }, /* nRightarrow */
+	{ 6631, 5, "\342\225\246" }, /* boxHD */
+	{ 15250, 5, "\342\206\276" }, /* uharr */
+	{ 263, 7, "\342\210\260" }, /* Cconint */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 15736, 5, "\342\212\202\342\203\222" }, /* vnsub */
+	{ 1252, 5, "\304\222" }, /* Emacr */
+	{ 9433, 8, "\342\247\235" }, /* infintie */
+	{ 11820, 5, "\342\253\205\314\270" }, /* nsubE */
+	{ 11691, 6, "\342\206\235\314\270" }, /* nrarrw */
+	{ 0, 0, "" },
+	{ 3947, 9, "\302\261" }, /* PlusMinus */
+	{ 15089, 8, "\342\217\242" }, /* trpezium */
+	{ 3286, 23, "\342\252\242\314\270" }, /* NotNestedGreaterGreater */
+	{ 8331, 7, "\316\265" }, /* epsilon */
+	{ 14772, 3, "\360\235\224\261" }, /* tfr */
+	{ 15770, 6, "\342\253\213\357\270\200" }, /* vsubnE */
+	{ 0, 0, "" },
+	{ 12137, 6, "\342\244\247" }, /* nwnear */
+	{ 5963, 8, "\342\246\255" }, /* angmsdaf */
+	{ 10690, 4, "\342\252\246" }, /* ltcc */
+	{ 14737, 4, "\342\216\264" }, /* tbrk */
+	{ 0, 0, "" },
+	{ 10287, 3, "\342\252\221" }, /* lgE */
+	{ 15256, 5, "\342\226\200" }, /* uhblk */
+	{ 0, 0, "" },
+	{ 12129, 7, "\342\206\226" }, /* nwarrow */
+	{ 11983, 16, "\342\213\255" }, /* ntrianglerighteq */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 10728, 7, "\342\251\273" }, /* ltquest */
+	{ 5012, 5, "\342\204\242" }, /* TRADE */
+	{ 10198, 4, "\342\213\232\357\270\200" }, /* lesg */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 11739, 4, "\360\235\223\203" }, /* nscr */
+	{ 11832, 7, "\342\212\202\342\203\222" }, /* nsubset */
+	{ 4128, 6, "\342\244\226" }, /* Rarrtl */
+	{ 1387, 3, "\360\235\224\211" }, /* Ffr */
+	{ 8945, 4, "\360\235\225\230" }, /* gopf */
+	{ 14523, 4, "\302\262" }, /* sup2 */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 5128, 10, "\342\211\210" }, /* TildeTilde */
+	{ 12494, 6, "\056" }, /* period */
+	{ 5639, 3, "\360\235\224\233" }, /* Xfr */
+	{ 8339, 5, "\317\265" }, /* epsiv */
+	{ 0, 0, "" },
+	{ 722, 8, "\342\211\220" }, /* DotEqual */
+	{ 1237, 6, "\303\210" }, /* Egrave */
+	{ 9516, 5, "\342\250\274" }, /* iprod */
+	{ 12323, 5, "\342\246\271" }, /* operp */
+	{ 13030, 4, "\342\206\222" }, /* rarr */
+	{ 1932, 5, "\320\204" }, /* Jukcy */
+	{ 4805, 17, "\342\212\221" }, /* SquareSubsetEqual */
+	{ 0, 0, "" },
+	{ 11606, 4, "\342\210\246" }, /* npar */
+	{ 10410, 5, "\342\213\246" }, /* lnsim */
+	{ 10478, 14, "\342\237\266" }, /* longrightarrow */
+	{ 9400, 5, "\304\261" }, /* imath */
+	{ 14199, 3, "\342\226\241" }, /* squ */
+	{ 14418, 6, "\342\253\225" }, /* subsub */
+	{ 0, 0, "" },
+	{ 12683, 3, "\342\252\263" }, /* prE */
+	{ 0, 0, "" },
+	{ 11282, 6, "\342\211\242" }, /* nequiv */
+	{ 4153, 2, "\342\204\234" }, /* Re */
+	{ 2350, 15, "\342\245\230" }, /* LeftUpVectorBar */
+	{ 15443, 6, "\305\251" }, /* utilde */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 347, 24, "\342\210\262" }, /* ClockwiseContourIntegral */
+	{ 9664, 6, "\304\270" }, /* kgreen */
+	{ 10606, 5, "\342\207\213" }, /* lrhar */
+	{ 13160, 5, "\342\246\214" }, /* rbrke */
+	{ 5221, 6, "\303\231" }, /* Ugrave */
+	{ 16043, 4, "\360\235\223\216" }, /* yscr */
+	{ 0, 0, "" },
+	{ 12216, 3, "\360\235\224\254" }, /* ofr */
+	{ 8313, 6, "\342\247\243" }, /* eparsl */
+	{ 11038, 4, "\342\211\253\314\270" }, /* nGtv */
+	{ 6733, 5, "\342\225\222" }, /* boxdR */
+	{ 13035, 6, "\342\245\265" }, /* rarrap */
+	{ 7345, 9, "\342\204\202" }, /* complexes */
+	{ 0, 0, "" },
+	{ 6538, 5, "\342\226\222" }, /* blk12 */
+	{ 0, 0, "" },
+	{ 10792, 5, "\342\210\272" }, /* mDDot */
+	{ 2813, 21, "\342\200\213" }, /* NegativeVeryThinSpace */
+	{ 0, 0, "" },
+	{ 2304, 16, "\342\245\221" }, /* LeftUpDownVector */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 1832, 14, "\342\201\243" }, /* InvisibleComma */
+	{ 0, 0, "" },
+	{ 960, 17, "\342\210\245" }, /* DoubleVerticalBar */
+	{ 15480, 4, "\342\207\225" }, /* vArr */
+	{ 11170, 8, "\342\204\225" }, /* naturals */
+	{ 13325, 10, "\342\206\222" }, /* rightarrow */
+	{ 15553, 9, "\342\210\235" }, /* varpropto */
+	{ 14799, 8, "\317\221" }, /* thetasym */
+	{ 8146, 6, "\304\233" }, /* ecaron */
+	{ 6130, 8, "\342\210\263" }, /* awconint */
+	{ 0, 0, "" },
+	{ 4021, 13, "\342\211\276" }, /* PrecedesTilde */
+	{ 591, 3, "\360\235\224\207" }, /* Dfr */
+	{ 0, 0, "" },
+	{ 10909, 5, "\302\265" }, /* micro */
+	{ 10769, 7, "\342\245\246" }, /* luruhar */
+	{ 5806, 3, "\320\260" }, /* acy */
+	{ 4671, 3, "\320\241" }, /* Scy */
+	{ 11240, 5, "\342\200\223" }, /* ndash */
+	{ 1189, 6, "\304\220" }, /* Dstrok */
+	{ 10142, 3, "\342\213\232" }, /* leg */
+	{ 0, 0, "" },
+	{ 11309, 7, "\342\210\204" }, /* nexists */
+	{ 9686, 4, "\360\235\223\200" }, /* kscr */
+	{ 294, 3, "\342\204\255" }, /* Cfr */
+	{ 0, 0, "" },
+	{ 8623, 6, "\302\275" }, /* frac12 */
+	{ 8308, 4, "\342\213\225" }, /* epar */
+	{ 11236, 3, "\320\275" }, /* ncy */
+	{ 8986, 5, "\342\251\272" }, /* gtcir */
+	{ 5823, 6, "\303\240" }, /* agrave */
+	{ 0, 0, "" },
+	{ 7880, 6, "\342\214\236" }, /* dlcorn */
+	{ 10591, 5, "\342\207\206" }, /* lrarr */
+	{ 9785, 4, "\342\206\220" }, /* larr */
+	{ 0, 0, "" },
+	{ 10695, 5, "\342\251\271" }, /* ltcir */
+	{ 15285, 5, "\342\227\270" }, /* ultri */
+	{ 8992, 5, "\342\213\227" }, /* gtdot */
+	{ 3106, 15, "\342\211\265" }, /* NotGreaterTilde */
+	{ 6275, 5, "\317\266" }, /* bepsi */
+	{ 0, 0, "" },
+	{ 9058, 7, "\342\211\267" }, /* gtrless */
+	{ 6110, 7, "\342\211\215" }, /* asympeq */
+	{ 11355, 5, "\342\211\265" }, /* ngsim */
+	{ 0, 0, "" },
+	{ 7040, 6, "\304\215" }, /* ccaron */
+	{ 1631, 2, "\342\211\253" }, /* Gt */
+	{ 6902, 4, "\342\210\275" }, /* bsim */
+	{ 12447, 3, "\342\210\245" }, /* par */
+	{ 12925, 5, "\077" }, /* quest */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 7028, 5, "\313\207" }, /* caron */
+	{ 0, 0, "" },
+	{ 10645, 4, "\342\211\262" }, /* lsim */
+	{ 0, 0, "" },
+	{ 6780, 8, "\342\212\237" }, /* boxminus */
+	{ 4709, 15, "\342\206\222" }, /* ShortRightArrow */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 1974, 4, "\360\235\222\246" }, /* Kscr */
+	{ 12838, 4, "\342\210\235" }, /* prop */
+	{ 15030, 15, "\342\212\265" }, /* trianglerighteq */
+	{ 6100, 3, "\052" }, /* ast */
+	{ 6684, 5, "\342\225\254" }, /* boxVH */
+	{ 8214, 2, "\342\252\231" }, /* el */
+	{ 7673, 6, "\342\200\240" }, /* dagger */
+	{ 7854, 13, "\342\213\207" }, /* divideontimes */
+	{ 2752, 3, "\320\235" }, /* Ncy */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 1583, 11, "\342\211\267" }, /* GreaterLess */
+	{ 5521, 11, "\342\210\243" }, /* VerticalBar */
+	{ 8707, 6, "\342\205\232" }, /* frac56 */
+	{ 0, 0, "" },
+	{ 15179, 4, "\342\206\221" }, /* uarr */
+	{ 394, 15, "\342\200\231" }, /* CloseCurlyQuote */
+	{ 16076, 4, "\305\274" }, /* zdot */
+	{ 11684, 6, "\342\244\263\314\270" }, /* nrarrc */
+	{ 3731, 6, "\303\221" }, /* Ntilde */
+	{ 11754, 14, "\342\210\246" }, /* nshortparallel */
+	{ 0, 0, "" },
+	{ 3627, 11, "\342\212\203\342\203\222" }, /* NotSuperset */
+	{ 5891, 4, "\342\251\232" }, /* andv */
+	{ 8426, 5, "\342\211\223" }, /* erDot */
+	{ 3472, 20, "\342\213\242" }, /* NotSquareSubsetEqual */
+	{ 0, 0, "" },
+	{ 7799, 7, "\342\213\204" }, /* diamond */
+	{ 6579, 4, "\360\235\225\223" }, /* bopf */
+	{ 0, 0, "" },
+	{ 4725, 12, "\342\206\221" }, /* ShortUpArrow */
+	{ 14120, 5, "\342\212\224" }, /* sqcup */
+	{ 1674, 4, "\342\204\215" }, /* Hopf */
+	{ 11317, 3, "\360\235\224\253" }, /* nfr */
+	{ 5900, 4, "\342\246\244" }, /* ange */
+	{ 0, 0, "" },
+	{ 2940, 20, "\342\210\246" }, /* NotDoubleVerticalBar */
+	{ 0, 0, "" },
+	{ 5144, 9, "\342\203\233" }, /* TripleDot */
+	{ 15520, 8, "\317\260" }, /* varkappa */
+	{ 8262, 6, "\342\210\205" }, /* emptyv */
+	{ 5819, 3, "\360\235\224\236" }, /* afr */
+	{ 0, 0, "" },
+	{ 14533, 4, "\342\253\206" }, /* supE */
+	{ 13833, 8, "\342\210\226" }, /* setminus */
+	{ 13877, 4, "\321\210" }, /* shcy */
+	{ 14281, 11, "\317\225" }, /* straightphi */
+	{ 38, 6, "\303\200" }, /* Agrave */
+	{ 10968, 4, "\342\253\233" }, /* mlcp */
+	{ 0, 0, "" },
+	{ 15332, 13, "\342\206\277" }, /* upharpoonleft */
+	{ 0, 0, "" },
+	{ 9324, 3, "\360\235\224\246" }, /* ifr */
+	{ 16124, 4, "\342\200\214" }, /* zwnj */
+	{ 0, 0, "" },
+	{ 15397, 6, "\342\214\235" }, /* urcorn */
+	{ 13118, 5, "\342\210\266" }, /* ratio */
+	{ 1370, 12, "\342\205\207" }, /* ExponentialE */
+	{ 7355, 4, "\342\211\205" }, /* cong */
+	{ 13777, 5, "\342\212\241" }, /* sdotb */
+	{ 4968, 3, "\342\210\221" }, /* Sum */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 5379, 10, "\342\206\245" }, /* UpTeeArrow */
+	{ 10434, 13, "\342\237\265" }, /* longleftarrow */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 14956, 8, "\342\226\265" }, /* triangle */
+	{ 942, 17, "\342\207\225" }, /* DoubleUpDownArrow */
+	{ 1551, 16, "\342\211\247" }, /* GreaterFullEqual */
+	{ 3016, 15, "\342\211\261" }, /* NotGreaterEqual */
+	{ 3243, 11, "\342\211\252\314\270" }, /* NotLessLess */
+	{ 7158, 15, "\342\206\272" }, /* circlearrowleft */
+	{ 0, 0, "" },
+	{ 14293, 5, "\302\257" }, /* strns */
+	{ 13891, 13, "\342\210\245" }, /* shortparallel */
+	{ 6637, 5, "\342\225\251" }, /* boxHU */
+	{ 11095, 6, "\342\212\257" }, /* nVDash */
+	{ 13297, 5, "\342\207\201" }, /* rhard */
+	{ 9529, 4, "\360\235\222\276" }, /* iscr */
+	{ 1228, 4, "\304\226" }, /* Edot */
+	{ 15978, 6, "\342\250\204" }, /* xuplus */
+	{ 2022, 6, "\304\275" }, /* Lcaron */
+	{ 15707, 6, "\342\213\256" }, /* vellip */
+	{ 684, 7, "\342\213\204" }, /* Diamond */
+	{ 15759, 5, "\342\212\263" }, /* vrtri */
+	{ 15244, 5, "\342\206\277" }, /* uharl */
+	{ 11861, 5, "\342\212\201" }, /* nsucc */
+	{ 4282, 12, "\342\214\211" }, /* RightCeiling */
+	{ 14505, 3, "\342\210\221" }, /* sum */
+	{ 3085, 20, "\342\251\276\314\270" }, /* NotGreaterSlantEqual */
+	{ 5037, 6, "\305\244" }, /* Tcaron */
+	{ 12348, 5, "\342\204\264" }, /* order */
+	{ 3936, 3, "\360\235\224\223" }, /* Pfr */
+	{ 3979, 8, "\342\211\272" }, /* Precedes */
+	{ 1984, 2, "\074" }, /* LT */
+	{ 0, 0, "" },
+	{ 15006, 9, "\342\211\234" }, /* triangleq */
+	{ 8234, 6, "\342\252\227" }, /* elsdot */
+	{ 12003, 3, "\043" }, /* num */
+	{ 0, 0, "" },
+	{ 12465, 6, "\342\253\263" }, /* parsim */
+	{ 11209, 6, "\305\206" }, /* ncedil */
+	{ 2112, 17, "\342\237\246" }, /* LeftDoubleBracket */
+	{ 9314, 5, "\302\241" }, /* iexcl */
+	{ 14692, 6, "\342\244\246" }, /* swarhk */
+	{ 13196, 5, "\342\214\211" }, /* rceil */
+	{ 8432, 5, "\342\245\261" }, /* erarr */
+	{ 13351, 16, "\342\207\201" }, /* rightharpoondown */
+	{ 0, 0, "" },
+	{ 3639, 16, "\342\212\211" }, /* NotSupersetEqual */
+	{ 0, 0, "" },
+	{ 6797, 8, "\342\212\240" }, /* boxtimes */
+	{ 6431, 6, "\342\244\215" }, /* bkarow */
+	{ 161, 4, "\316\222" }, /* Beta */
+	{ 8906, 3, "\342\211\251" }, /* gnE */
+	{ 5113, 14, "\342\211\205" }, /* TildeFullEqual */
+	{ 5838, 5, "\342\204\265" }, /* aleph */
+	{ 11780, 6, "\342\211\204" }, /* nsimeq */
+	{ 9942, 3, "\320\273" }, /* lcy */
+	{ 17, 6, "\304\202" }, /* Abreve */
+	{ 2230, 12, "\342\206\244" }, /* LeftTeeArrow */
+	{ 13056, 5, "\342\244\263" }, /* rarrc */
+	{ 10273, 6, "\342\214\212" }, /* lfloor */
+	{ 6298, 7, "\342\211\254" }, /* between */
+	{ 6956, 5, "\342\211\217" }, /* bumpe */
+	{ 763, 15, "\342\207\223" }, /* DoubleDownArrow */
+	{ 0, 0, "" },
+	{ 14336, 5, "\342\253\213" }, /* subnE */
+	{ 0, 0, "" },
+	{ 257, 5, "\304\210" }, /* Ccirc */
+	{ 5619, 5, "\342\213\200" }, /* Wedge */
+	{ 14425, 6, "\342\253\223" }, /* subsup */
+	{ 0, 0, "" },
+	{ 6026, 7, "\342\215\274" }, /* angzarr */
+	{ 9469, 8, "\342\212\272" }, /* intercal */
+	{ 0, 0, "" },
+	{ 13542, 5, "\342\246\206" }, /* ropar */
+	{ 3932, 3, "\320\237" }, /* Pcy */
+	{ 0, 0, "" },
+	{ 15991, 4, "\342\213\201" }, /* xvee */
+	{ 8981, 4, "\342\252\247" }, /* gtcc */
+	{ 7279, 8, "\342\231\243" }, /* clubsuit */
+	{ 4448, 18, "\342\212\265" }, /* RightTriangleEqual */
+	{ 8869, 3, "\360\235\224\244" }, /* gfr */
+	{ 3907, 15, "\342\217\234" }, /* OverParenthesis */
+	{ 3794, 7, "\316\237" }, /* Omicron */
+	{ 10754, 5, "\342\227\202" }, /* ltrif */
+	{ 7288, 5, "\072" }, /* colon */
+	{ 12737, 11, "\342\252\271" }, /* precnapprox */
+	{ 6227, 8, "\342\216\266" }, /* bbrktbrk */
+	{ 0, 0, "" },
+	{ 0, 0, "" },
+	{ 5187, 5, "\320\216" }, /* Ubrcy */
+	{ 7322, 4, "\342\210\201" }, /* comp */
+	{ 13524, 5, "\342\237\255" }, /* roang */
+	{ 6048, 3, "\342\251\260" }, /* apE */
+	{ 0, 0, "" },
+	{ 1153, 7, "\342\212\244" }, /* DownTee */
+	{ 8672, 6, "\342\205\226" }, /* frac25 */
+	{ 16115, 4, "\360\235\223\217" }, /* zscr */
+	{ 1516, 4, "\360\235\224\276" }, /* Gopf */
+	{ 0, 0, "" },
+};
+
+static unsigned int
+hash_entity(unsigned int seed, const char *str, unsigned int len)
+{
+	unsigned int h = 2166136261u ^ seed, i;
+
+	for (i = 0; i < len; ++i) {
+		h ^= (unsigned char)str[i];
+		h = (h * 16777619u) & 0xffffffff;
+	}
+
+	return h;
+}
+
+static const struct html_entity *
+find_entity(const char *str, unsigned int len)
+{
+	const struct html_entity *entity;
+	unsigned int seed;
+
+	if (len < ENTITY_MIN_LENGTH || len > ENTITY_MAX_LENGTH)
+		return 0;
+
+	seed = entity_seeds[hash_entity(0, str, len) % ENTITY_BUCKETS];
+	entity = &entity_table[hash_entity(seed, str, len) % ENTITY_SLOTS];
+
+	if (entity->size == len && memcmp(entity_names + entity->name, str, len) == 0)
+		return entity;
+
+	return 0;
+}
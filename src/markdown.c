@@ -24,11 +24,23 @@
 #include <string.h>
 #include <ctype.h>
 #include <stdio.h>
+#include <time.h>
+#include <limits.h>
 
 #if defined(_WIN32)
 #define strncasecmp	_strnicmp
 #endif
 
+/* render generations, shared with the thread calling sd_markdown_cancel */
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define RNDR_LOAD(p) _InterlockedCompareExchange((p), 0, 0)
+#define RNDR_STORE(p, v) _InterlockedExchange((p), (v))
+#else
+#define RNDR_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define RNDR_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#endif
+
 #define REF_TABLE_SIZE 8
 
 #define BUFFER_BLOCK 0
@@ -36,10 +48,24 @@
 
 #define MKD_LI_END 8	/* internal list flag */
 
+/* SD_RENDER_STATS fills the sd_render_stats of every render; without it */
+/* the counting compiles to nothing */
+#ifdef SD_RENDER_STATS
+#define RNDR_STATS(x) x
+#else
+#define RNDR_STATS(x)
+#endif
+
+/* parser steps between two checks of the render limits */
+#ifndef STEP_INTERVAL
+#define STEP_INTERVAL 64
+#endif
+
 #define gperf_case_strncmp(s1, s2, n) strncasecmp(s1, s2, n)
 #define GPERF_DOWNCASE 1
 #define GPERF_CASE_STRNCMP 1
 #include "html_blocks.h"
+#include "html_entities.h"
 
 /***************
  * LOCAL TYPES *
@@ -55,6 +81,101 @@ struct link_ref {
 	struct link_ref *next;
 };
 
+/* html_miss: closing tag known to be missing from a point to the end */
+struct html_miss {
+	const char *tag;
+	uint8_t *from;
+	uint8_t *end;
+};
+
+#define HTML_MISS_SIZE 8
+
+/* span_frame: an inline span whose content is being parsed */
+struct span_frame {
+	int type;
+	struct buf *ob;
+
+	uint8_t *data;
+	size_t size;
+	size_t i, end;
+
+	/* first char after the span, in the data of its parent */
+	uint8_t *resume;
+
+	/* link spans */
+	struct buf *link;
+	struct buf *title;
+	size_t org_work_size;
+
+	/* where the content starts in ob; spans rendered between enter */
+	/* and leave also keep where they and their parent started */
+	size_t start;
+	int events;
+	size_t offset;
+	size_t parent_offset;
+	uint8_t *source;
+};
+
+enum span_frame_t {
+	SPAN_ROOT,
+	SPAN_EMPHASIS,
+	SPAN_DOUBLE_EMPHASIS,
+	SPAN_TRIPLE_EMPHASIS,
+	SPAN_STRIKETHROUGH,
+	SPAN_SUPERSCRIPT,
+	SPAN_LINK,
+};
+
+static const int span_node[] = {
+	0,
+	SD_NODE_EMPHASIS,
+	SD_NODE_DOUBLE_EMPHASIS,
+	SD_NODE_TRIPLE_EMPHASIS,
+	SD_NODE_STRIKETHROUGH,
+	SD_NODE_SUPERSCRIPT,
+	SD_NODE_LINK,
+};
+
+/* block_frame: a block sequence or container block being parsed */
+struct block_frame {
+	int type;
+	struct buf *ob;
+	struct buf *work;
+
+	uint8_t *data;
+	size_t size;
+	size_t beg;
+
+	/* data consumed by the block in its parent sequence */
+	size_t end;
+
+	/* lists and list items */
+	int flags;
+	size_t sublist;
+	int stage;
+
+	/* where the content starts in its output; blocks rendered between */
+	/* enter and leave also keep where they and their parent started */
+	size_t start;
+	int events;
+	size_t offset;
+	size_t parent_offset;
+};
+
+enum block_frame_t {
+	BLOCK_SEQUENCE,
+	BLOCK_QUOTE,
+	BLOCK_LIST,
+	BLOCK_LISTITEM,
+};
+
+static const int block_node[] = {
+	0,
+	SD_NODE_BLOCKQUOTE,
+	SD_NODE_LIST,
+	SD_NODE_LISTITEM,
+};
+
 /* char_trigger: function pointer to render active chars */
 /*   returns the number of chars taken care of */
 /*   data is the pointer of the beginning of the span */
@@ -90,6 +211,19 @@ enum markdown_char_t {
 	MD_CHAR_SUPERSCRIPT,
 };
 
+/* block_char: block parsers worth trying for a given first non-space char */
+enum markdown_block_t {
+	MD_BLOCK_ATX = (1 << 0),
+	MD_BLOCK_HTML = (1 << 1),
+	MD_BLOCK_EMPTY = (1 << 2),
+	MD_BLOCK_HRULE = (1 << 3),
+	MD_BLOCK_FENCE = (1 << 4),
+	MD_BLOCK_QUOTE = (1 << 5),
+	MD_BLOCK_ULI = (1 << 6),
+	MD_BLOCK_OLI = (1 << 7),
+	MD_BLOCK_CODE = (1 << 8),
+};
+
 static char_trigger markdown_char_ptrs[] = {
 	NULL,
 	&char_emphasis,
@@ -112,16 +246,80 @@ struct sd_markdown {
 
 	struct link_ref *refs[REF_TABLE_SIZE];
 	uint8_t active_char[256];
+	uint8_t block_char[256];
 	struct stack work_bufs[2];
+	struct stack span_frames;
+	struct stack block_frames;
+	struct html_miss html_misses[HTML_MISS_SIZE];
+	struct {
+		uint8_t *data;
+		size_t size;
+		size_t len;
+	} html_last;
+	struct sd_autolink_stats autolink_stats;
 	unsigned int ext_flags;
 	size_t max_nesting;
 	int in_link_body;
+	int events;
+	int spans;		/* some span or low level callback is set */
+	uint8_t *trigger;	/* active char handled by parse_span */
+	struct {
+		uint8_t *data;
+		size_t size;
+	} text_held;		/* text before an autolink trigger, not rendered yet */
+	size_t budget;		/* visible chars left to render, SIZE_MAX for all */
+	size_t budget_start;	/* budget the render started with */
+	int stopped;		/* parsing given up once the budget ran out */
+	enum sd_render_status status;
+
+	/* limits of sd_markdown_set_limits, 0 for none */
+	size_t step_limit;
+	unsigned long time_limit;
+	size_t steps;			/* steps left before the next check */
+	size_t step_total;		/* steps taken up to the last check */
+	unsigned long time_start;
+
+	/* generation of the render under way, and of the one cancelled; */
+	/* both only go through RNDR_LOAD and RNDR_STORE */
+	volatile long render_id;
+	volatile long cancel_id;
+
+#ifdef SD_RENDER_STATS
+	struct sd_render_stats stats;
+#endif
 };
 
 /***************************
  * HELPER FUNCTIONS *
  ***************************/
 
+#ifdef SD_RENDER_STATS
+/* rndr_count_bufs • keeps the highest use of the work buffers */
+static void
+rndr_count_bufs(struct sd_markdown *rndr, int type)
+{
+	size_t nesting = rndr->work_bufs[BUFFER_SPAN].size + rndr->work_bufs[BUFFER_BLOCK].size;
+
+	if ((size_t)rndr->work_bufs[type].size > rndr->stats.work_bufs_max[type])
+		rndr->stats.work_bufs_max[type] = rndr->work_bufs[type].size;
+
+	if (nesting > rndr->stats.max_nesting)
+		rndr->stats.max_nesting = nesting;
+}
+
+/* rndr_count_trigger • counts an inline parser run for an active char */
+static void
+rndr_count_trigger(struct sd_markdown *rndr, uint8_t c, uint8_t action, int hit)
+{
+	rndr->stats.triggers[action - 1]++;
+
+	if (hit)
+		rndr->stats.trigger_hits[c]++;
+	else
+		rndr->stats.trigger_misses[c]++;
+}
+#endif
+
 static inline struct buf *
 rndr_newbuf(struct sd_markdown *rndr, int type)
 {
@@ -136,8 +334,10 @@ rndr_newbuf(struct sd_markdown *rndr, int type)
 	} else {
 		work = bufnew(buf_size[type]);
 		stack_push(pool, work);
+		RNDR_STATS(rndr->stats.work_bufs_new[type]++);
 	}
 
+	RNDR_STATS(rndr_count_bufs(rndr, type));
 	return work;
 }
 
@@ -147,6 +347,133 @@ rndr_popbuf(struct sd_markdown *rndr, int type)
 	rndr->work_bufs[type].size--;
 }
 
+/* rndr_newframe • pushes a cleared frame, reusing the ones already allocated */
+static void *
+rndr_newframe(struct stack *frames, size_t frame_size)
+{
+	void *frame = NULL;
+
+	if (frames->size < frames->asize &&
+		frames->item[frames->size] != NULL) {
+		frame = frames->item[frames->size++];
+	} else {
+		frame = malloc(frame_size);
+		stack_push(frames, frame);
+	}
+
+	memset(frame, 0x0, frame_size);
+	return frame;
+}
+
+/* rndr_clock • milliseconds elapsed from an arbitrary point */
+static unsigned long
+rndr_clock(void)
+{
+#if defined(_WIN32)
+	/* the Windows clock counts wall time, not processor time */
+	return (unsigned long)((double)clock() * 1000 / CLOCKS_PER_SEC);
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#endif
+}
+
+#ifdef SD_RENDER_STATS
+/* stats_clock • rndr_clock with the fraction of a millisecond */
+static double
+stats_clock(void)
+{
+#if defined(_WIN32)
+	return (double)clock() * 1000 / CLOCKS_PER_SEC;
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1000 + (double)ts.tv_nsec / 1000000;
+#endif
+}
+#endif
+
+/* rndr_check • stops the parser when it is cancelled or past its limits */
+static void
+rndr_check(struct sd_markdown *rndr)
+{
+	rndr->steps = STEP_INTERVAL;
+	rndr->step_total += STEP_INTERVAL;
+
+	if (RNDR_LOAD(&rndr->cancel_id) == rndr->render_id) {
+		rndr->status = SD_RENDER_CANCELLED;
+		rndr->stopped = 1;
+	} else if ((rndr->step_limit && rndr->step_total >= rndr->step_limit) ||
+		(rndr->time_limit && rndr_clock() - rndr->time_start >= rndr->time_limit)) {
+		rndr->status = SD_RENDER_TIMEOUT;
+		rndr->stopped = 1;
+	}
+}
+
+/* rndr_step • counts a block or an inline trigger, the limits being */
+/*	checked every STEP_INTERVAL of them; returns whether to stop */
+static inline int
+rndr_step(struct sd_markdown *rndr)
+{
+	if (--rndr->steps == 0)
+		rndr_check(rndr);
+
+	return rndr->stopped;
+}
+
+/* rndr_nesting • whether the work buffers in use go past max_nesting */
+static inline int
+rndr_nesting(struct sd_markdown *rndr)
+{
+	return rndr->work_bufs[BUFFER_SPAN].size +
+		rndr->work_bufs[BUFFER_BLOCK].size > rndr->max_nesting;
+}
+
+/* node_init • prepares a node to be rendered between enter and leave */
+static void
+node_init(struct sd_node *node, int type, int flags, size_t parent_offset)
+{
+	node->type = type;
+	node->flags = flags;
+	node->link = NULL;
+	node->title = NULL;
+	node->parent_offset = parent_offset;
+	node->offset = 0;
+	node->content_offset = 0;
+	node->source = NULL;
+	node->source_size = 0;
+	node->content_begin = 0;
+	node->content_end = 0;
+}
+
+/* node_source • points a span node at its markdown, size being 0 when */
+/*	the content is left unparsed */
+static void
+node_source(struct sd_node *node, const uint8_t *source,
+	const uint8_t *data, size_t size, const uint8_t *resume)
+{
+	node->source = source;
+	node->source_size = resume - source;
+	node->content_begin = size ? (size_t)(data - source) : node->source_size;
+	node->content_end = node->content_begin + size;
+}
+
+/* node_enter • opens a node in ob, returning the result of enter */
+static int
+node_enter(struct sd_markdown *rndr, struct sd_node *node, struct buf *ob)
+{
+	int r;
+
+	node->offset = ob->size;
+	r = rndr->cb.enter(ob, node, rndr->opaque);
+	node->content_offset = ob->size;
+
+	return r;
+}
+
 static void
 unscape_text(struct buf *ob, struct buf *src)
 {
@@ -250,6 +577,55 @@ _isspace(int c)
 	return c == ' ' || c == '\n';
 }
 
+/* rndr_fit • spends the budget on a run of visible text, returning how */
+/*	much of it to render; a run going past the budget is cut after its */
+/*	last whole word and stops the parser */
+static size_t
+rndr_fit(struct sd_markdown *rndr, const uint8_t *data, size_t size)
+{
+	size_t i, cut, chars = 0;
+
+	if (rndr->budget == SIZE_MAX)
+		return size;
+
+	/* counting UTF-8 chars up to the first one past the budget */
+	for (i = 0; i < size; ++i)
+		if ((data[i] & 0xC0) != 0x80 && chars++ == rndr->budget)
+			break;
+
+	if (i == size) {
+		rndr->budget -= chars;
+		return size;
+	}
+
+	cut = i;
+	if (!_isspace(data[cut])) {
+		while (cut > 0 && !_isspace(data[cut - 1]))
+			cut--;
+
+		/* a single word longer than the budget is cut where it ends, */
+		/* when nothing was rendered before it */
+		if (cut == 0 && rndr->budget == rndr->budget_start)
+			cut = i;
+	}
+
+	while (cut > 0 && _isspace(data[cut - 1]))
+		cut--;
+
+	rndr->budget = 0;
+	rndr->stopped = 1;
+	return cut;
+}
+
+/* rndr_spend • spends the budget on visible text rendered whole, such as */
+/*	an entity or an autolink */
+static inline void
+rndr_spend(struct sd_markdown *rndr, size_t chars)
+{
+	if (rndr->budget != SIZE_MAX)
+		rndr->budget -= (chars < rndr->budget) ? chars : rndr->budget;
+}
+
 /****************************
  * INLINE PARSING FUNCTIONS *
  ****************************/
@@ -348,36 +724,147 @@ tag_length(uint8_t *data, size_t size, enum mkd_autolink *autolink)
 	return i + 1;
 }
 
-/* parse_inline • parses inline markdown elements */
+/* push_span • starts parsing the content of a span into ob */
+static struct span_frame *
+push_span(struct sd_markdown *rndr, int type, struct buf *ob,
+	uint8_t *data, size_t size, uint8_t *resume)
+{
+	struct span_frame *frame;
+
+	frame = rndr_newframe(&rndr->span_frames, sizeof(struct span_frame));
+	frame->type = type;
+	frame->ob = ob;
+	frame->data = data;
+	frame->size = rndr_nesting(rndr) ? 0 : size;
+	frame->resume = resume;
+	frame->start = ob->size;
+
+	return frame;
+}
+
+/* span_start • where the content of the span being parsed starts in its ob */
+static inline size_t
+span_start(struct sd_markdown *rndr)
+{
+	struct span_frame *frame = stack_top(&rndr->span_frames);
+	return frame->start;
+}
+
+/* open_span • starts parsing the content of an emphasis-like span */
+/*	with enter and leave, the content goes straight into ob and the */
+/*	work buffer stays reserved and empty so nesting limits still match; */
+/*	returns NULL when enter turns the span down */
+static struct span_frame *
+open_span(struct sd_markdown *rndr, int type, struct buf *ob,
+	uint8_t *data, size_t size, uint8_t *resume)
+{
+	struct buf *work = rndr_newbuf(rndr, BUFFER_SPAN);
+	struct span_frame *frame;
+	struct sd_node node;
+
+	if (!rndr->events)
+		return push_span(rndr, type, work, data, size, resume);
+
+	node_init(&node, span_node[type], 0, span_start(rndr));
+	node_source(&node, rndr->trigger, data, rndr_nesting(rndr) ? 0 : size, resume);
+	if (!node_enter(rndr, &node, ob)) {
+		ob->size = node.offset;
+		rndr_popbuf(rndr, BUFFER_SPAN);
+		return NULL;
+	}
+
+	frame = push_span(rndr, type, ob, data, size, resume);
+	frame->source = rndr->trigger;
+	frame->events = 1;
+	frame->offset = node.offset;
+	frame->parent_offset = node.parent_offset;
+	return frame;
+}
+
+/* put_text • renders a run of text as it is */
 static void
-parse_inline(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
+put_text(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
 {
-	size_t i = 0, end = 0;
-	uint8_t action = 0;
 	struct buf work = { 0, 0, 0, 0 };
 
-	if (rndr->work_bufs[BUFFER_SPAN].size +
-		rndr->work_bufs[BUFFER_BLOCK].size > rndr->max_nesting)
+	if (rndr->cb.normal_text) {
+		work.data = data;
+		work.size = size;
+		rndr->cb.normal_text(ob, &work, rndr->opaque);
+	}
+	else
+		bufput(ob, data, size);
+}
+
+/* release_text • renders the text held before an autolink trigger, but */
+/*	for the last rewind bytes the link takes back */
+static void
+release_text(struct buf *ob, struct sd_markdown *rndr, size_t rewind)
+{
+	uint8_t *data = rndr->text_held.data;
+	size_t size = rndr->text_held.size;
+
+	if (!data)
 		return;
 
-	while (i < size) {
+	rndr->text_held.data = NULL;
+	rndr->text_held.size = 0;
+	put_text(ob, rndr, data, size - rewind);
+}
+
+/* parse_span • parses the content of a span until it is over, returning 1, */
+/*	or until a trigger pushes a nested span, returning 0 */
+static int
+parse_span(struct sd_markdown *rndr, struct span_frame *frame)
+{
+	uint8_t *data = frame->data;
+	size_t i = frame->i, end = frame->end, size = frame->size, depth, len;
+	uint8_t action = 0;
+
+	while (i < size && !rndr->stopped) {
 		/* copying inactive chars into the output */
 		while (end < size && (action = rndr->active_char[data[end]]) == 0) {
 			end++;
 		}
 
-		if (rndr->cb.normal_text) {
-			work.data = data + i;
-			work.size = end - i;
-			rndr->cb.normal_text(ob, &work, rndr->opaque);
+		len = rndr_fit(rndr, data + i, end - i);
+
+		/* an autolink takes back the end of the text before it, which */
+		/* is rendered once the link knows where it starts: the rendered */
+		/* text need not be as long as the source */
+		if (end < size && len == end - i &&
+			(action == MD_CHAR_AUTOLINK_URL || action == MD_CHAR_AUTOLINK_EMAIL)) {
+			rndr->text_held.data = data + i;
+			rndr->text_held.size = len;
 		}
 		else
-			bufput(ob, data + i, end - i);
+			put_text(frame->ob, rndr, data + i, len);
 
-		if (end >= size) break;
+		if (end >= size || rndr->stopped) break;
 		i = end;
 
-		end = markdown_char_ptrs[(int)action](ob, rndr, data + i, i, size - i);
+		/* nothing more is rendered once the budget is spent */
+		if (rndr->budget == 0)
+			rndr->stopped = 1;
+
+		if (rndr_step(rndr)) {
+			release_text(frame->ob, rndr, 0);
+			break;
+		}
+
+		depth = rndr->span_frames.size;
+		rndr->trigger = data + i;
+		end = markdown_char_ptrs[(int)action](frame->ob, rndr, data + i, i, size - i);
+		release_text(frame->ob, rndr, 0);
+		RNDR_STATS(rndr_count_trigger(rndr, data[i], action,
+			end != 0 || rndr->span_frames.size > depth));
+
+		if (rndr->span_frames.size > depth) {
+			/* nested span: resumed by close_span */
+			frame->i = i;
+			return 0;
+		}
+
 		if (!end) /* no action from the callback */
 			end = i + 1;
 		else {
@@ -385,6 +872,121 @@ parse_inline(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t siz
 			end = i;
 		}
 	}
+
+	return 1;
+}
+
+/* close_span • renders a parsed span and resumes its parent after it */
+static void
+close_span(struct sd_markdown *rndr, struct span_frame *frame, struct span_frame *parent)
+{
+	struct buf *u_link = 0;
+	struct sd_node node;
+	int r = 0, empty;
+
+	/* a span cut by the budget before any of its content is left out */
+	empty = rndr->stopped && frame->ob->size == frame->start;
+
+	if (frame->events) {
+		if (frame->type == SPAN_LINK)
+			rndr->in_link_body = 0;
+
+		node_init(&node, span_node[frame->type], 0, frame->parent_offset);
+		node_source(&node, frame->source, frame->data, frame->size, frame->resume);
+		node.link = frame->link;
+		node.title = frame->title;
+		node.offset = frame->offset;
+		node.content_offset = frame->start;
+
+		r = rndr->cb.leave(frame->ob, &node, rndr->opaque);
+		if (!r || empty)
+			frame->ob->size = node.offset;
+
+		if (frame->type == SPAN_LINK)
+			rndr->work_bufs[BUFFER_SPAN].size = frame->org_work_size;
+		else
+			rndr_popbuf(rndr, BUFFER_SPAN);
+
+		/* superscripts are consumed even when left out */
+		if (frame->type == SPAN_SUPERSCRIPT)
+			r = 1;
+	} else if (empty) {
+		if (frame->type == SPAN_LINK) {
+			rndr->in_link_body = 0;
+			rndr->work_bufs[BUFFER_SPAN].size = frame->org_work_size;
+		} else
+			rndr_popbuf(rndr, BUFFER_SPAN);
+	} else switch (frame->type) {
+	case SPAN_EMPHASIS:
+		r = rndr->cb.emphasis(parent->ob, frame->ob, rndr->opaque);
+		rndr_popbuf(rndr, BUFFER_SPAN);
+		break;
+
+	case SPAN_DOUBLE_EMPHASIS:
+		r = rndr->cb.double_emphasis(parent->ob, frame->ob, rndr->opaque);
+		rndr_popbuf(rndr, BUFFER_SPAN);
+		break;
+
+	case SPAN_TRIPLE_EMPHASIS:
+		r = rndr->cb.triple_emphasis(parent->ob, frame->ob, rndr->opaque);
+		rndr_popbuf(rndr, BUFFER_SPAN);
+		break;
+
+	case SPAN_STRIKETHROUGH:
+		r = rndr->cb.strikethrough(parent->ob, frame->ob, rndr->opaque);
+		rndr_popbuf(rndr, BUFFER_SPAN);
+		break;
+
+	case SPAN_SUPERSCRIPT:
+		rndr->cb.superscript(parent->ob, frame->ob, rndr->opaque);
+		rndr_popbuf(rndr, BUFFER_SPAN);
+		r = 1;
+		break;
+
+	case SPAN_LINK:
+		rndr->in_link_body = 0;
+
+		if (frame->link) {
+			u_link = rndr_newbuf(rndr, BUFFER_SPAN);
+			unscape_text(u_link, frame->link);
+		}
+
+		r = rndr->cb.link(parent->ob, u_link, frame->title, frame->ob, rndr->opaque);
+		rndr->work_bufs[BUFFER_SPAN].size = frame->org_work_size;
+		break;
+	}
+
+	if (r) {
+		parent->i = frame->resume - parent->data;
+		parent->end = parent->i;
+	} else
+		parent->end = parent->i + 1;
+}
+
+/* parse_inline • parses inline markdown elements */
+/*	spans with a content of their own are not parsed recursively: their */
+/*	trigger pushes a frame on span_frames, so nesting costs heap, not stack */
+static void
+parse_inline(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
+{
+	size_t base = rndr->span_frames.size;
+	struct span_frame *frame;
+
+	if (rndr_nesting(rndr))
+		return;
+
+	push_span(rndr, SPAN_ROOT, ob, data, size, NULL);
+
+	while (rndr->span_frames.size > base) {
+		frame = stack_top(&rndr->span_frames);
+
+		if (!parse_span(rndr, frame))
+			continue;
+
+		rndr->span_frames.size--;
+		if (rndr->span_frames.size > base)
+			close_span(rndr, frame, stack_top(&rndr->span_frames));
+	}
 }
 
 /* find_emph_char • looks for the next emph uint8_t, skipping other constructs */
@@ -484,8 +1086,6 @@ static size_t
 parse_emph1(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size, uint8_t c)
 {
 	size_t i = 0, len;
-	struct buf *work = 0;
-	int r;
 
 	if (!rndr->cb.emphasis) return 0;
 
@@ -505,11 +1105,9 @@ parse_emph1(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size
 					continue;
 			}
 
-			work = rndr_newbuf(rndr, BUFFER_SPAN);
-			parse_inline(work, rndr, data, i);
-			r = rndr->cb.emphasis(ob, work, rndr->opaque);
-			rndr_popbuf(rndr, BUFFER_SPAN);
-			return r ? i + 1 : 0;
+			if (!open_span(rndr, SPAN_EMPHASIS, ob, data, i, data + i + 1))
+				return 0;
+			return i + 1;
 		}
 	}
 
@@ -522,8 +1120,6 @@ parse_emph2(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size
 {
 	int (*render_method)(struct buf *ob, const struct buf *text, void *opaque);
 	size_t i = 0, len;
-	struct buf *work = 0;
-	int r;
 
 	render_method = (c == '~') ? rndr->cb.strikethrough : rndr->cb.double_emphasis;
 
@@ -536,11 +1132,10 @@ parse_emph2(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size
 		i += len;
 
 		if (i + 1 < size && data[i] == c && data[i + 1] == c && i && !_isspace(data[i - 1])) {
-			work = rndr_newbuf(rndr, BUFFER_SPAN);
-			parse_inline(work, rndr, data, i);
-			r = render_method(ob, work, rndr->opaque);
-			rndr_popbuf(rndr, BUFFER_SPAN);
-			return r ? i + 2 : 0;
+			if (!open_span(rndr, (c == '~') ? SPAN_STRIKETHROUGH : SPAN_DOUBLE_EMPHASIS,
+					ob, data, i, data + i + 2))
+				return 0;
+			return i + 2;
 		}
 		i++;
 	}
@@ -553,7 +1148,6 @@ static size_t
 parse_emph3(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size, uint8_t c)
 {
 	size_t i = 0, len;
-	int r;
 
 	while (i < size) {
 		len = find_emph_char(data + i, size - i, c);
@@ -566,12 +1160,9 @@ parse_emph3(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size
 
 		if (i + 2 < size && data[i + 1] == c && data[i + 2] == c && rndr->cb.triple_emphasis) {
 			/* triple symbol found */
-			struct buf *work = rndr_newbuf(rndr, BUFFER_SPAN);
-
-			parse_inline(work, rndr, data, i);
-			r = rndr->cb.triple_emphasis(ob, work, rndr->opaque);
-			rndr_popbuf(rndr, BUFFER_SPAN);
-			return r ? i + 3 : 0;
+			if (!open_span(rndr, SPAN_TRIPLE_EMPHASIS, ob, data, i, data + i + 3))
+				return 0;
+			return i + 3;
 
 		} else if (i + 1 < size && data[i + 1] == c) {
 			/* double symbol found, handing over to emph1 */
@@ -636,7 +1227,7 @@ char_linebreak(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t o
 		return 0;
 
 	/* removing the last space from ob and rendering */
-	while (ob->size && ob->data[ob->size - 1] == ' ')
+	while (ob->size > span_start(rndr) && ob->data[ob->size - 1] == ' ')
 		ob->size--;
 
 	return rndr->cb.linebreak(ob, rndr->opaque) ? 1 : 0;
@@ -672,6 +1263,14 @@ char_codespan(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t of
 	while (f_end > nb && data[f_end-1] == ' ')
 		f_end--;
 
+	if (f_begin < f_end) {
+		f_end = f_begin + rndr_fit(rndr, data + f_begin, f_end - f_begin);
+
+		/* none of the code fits the budget: the span is left out */
+		if (f_begin == f_end)
+			return 0;
+	}
+
 	/* real code span */
 	if (f_begin < f_end) {
 		struct buf work = { data + f_begin, f_end - f_begin, 0, 0 };
@@ -697,6 +1296,7 @@ char_escape(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offs
 		if (strchr(escape_chars, data[1]) == NULL)
 			return 0;
 
+		rndr_spend(rndr, 1);
 		if (rndr->cb.normal_text) {
 			work.data = data + 1;
 			work.size = 1;
@@ -704,12 +1304,44 @@ char_escape(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offs
 		}
 		else bufputc(ob, data[1]);
 	} else if (size == 1) {
+		rndr_spend(rndr, 1);
 		bufputc(ob, data[0]);
 	}
 
 	return 2;
 }
 
+/* is_entity • whether the text between '&' and ';' is a known entity */
+static int
+is_entity(uint8_t *data, size_t size)
+{
+	size_t i = 1, digits;
+	unsigned long cp = 0;
+	int hex = 0;
+
+	if (size == 0 || data[0] != '#')
+		return find_entity((const char *)data, (unsigned int)size) != NULL;
+
+	if (i < size && (data[i] == 'x' || data[i] == 'X')) {
+		hex = 1;
+		i++;
+	}
+
+	for (digits = 0; i < size && digits < 8; ++i, ++digits) {
+		if (data[i] >= '0' && data[i] <= '9')
+			cp = cp * (hex ? 16 : 10) + (data[i] - '0');
+		else if (hex && data[i] >= 'a' && data[i] <= 'f')
+			cp = cp * 16 + (data[i] - 'a' + 10);
+		else if (hex && data[i] >= 'A' && data[i] <= 'F')
+			cp = cp * 16 + (data[i] - 'A' + 10);
+		else
+			return 0;
+	}
+
+	return i == size && digits > 0 && cp > 0 && cp <= 0x10FFFF &&
+		(cp < 0xD800 || cp > 0xDFFF);
+}
+
 /* char_entity • '&' escaped when it doesn't belong to an entity */
 /* valid entities are assumed to be anything matching &#?[A-Za-z0-9]+; */
 static size_t
@@ -729,6 +1361,11 @@ char_entity(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offs
 	else
 		return 0; /* lone '&' */
 
+	if ((rndr->ext_flags & MKDEXT_STRICT_ENTITIES) != 0 &&
+		!is_entity(data + 1, end - 2))
+		return 0; /* unknown name, left to be escaped */
+
+	rndr_spend(rndr, 1);
 	if (rndr->cb.entity) {
 		work.data = data;
 		work.size = end;
@@ -756,6 +1393,8 @@ char_langle_tag(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 			unscape_text(u_link, &work);
 			ret = rndr->cb.autolink(ob, u_link, altype, rndr->opaque);
 			rndr_popbuf(rndr, BUFFER_SPAN);
+			if (ret)
+				rndr_spend(rndr, end - 2);
 		}
 		else if (rndr->cb.raw_html_tag)
 			ret = rndr->cb.raw_html_tag(ob, &work, rndr->opaque);
@@ -774,9 +1413,20 @@ char_autolink_www(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_
 	if (!rndr->cb.link || rndr->in_link_body)
 		return 0;
 
+	rndr->autolink_stats.triggers++;
+
+	/* "www." following the start of the text, a space or a punctuation */
+	if (size < 4 || memcmp(data + 1, "ww.", 3) != 0 ||
+		(offset && !ispunct(data[-1]) && !isspace(data[-1]))) {
+		rndr->autolink_stats.filtered++;
+		return 0;
+	}
+
 	link = rndr_newbuf(rndr, BUFFER_SPAN);
 
 	if ((link_len = sd_autolink__www(&rewind, link, data, offset, size, 0)) > 0) {
+		rndr->autolink_stats.links++;
+		rndr_spend(rndr, link->size);
 		link_url = rndr_newbuf(rndr, BUFFER_SPAN);
 		BUFPUTSL(link_url, "http://");
 		bufput(link_url, link->data, link->size);
@@ -806,10 +1456,20 @@ char_autolink_email(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, siz
 	if (!rndr->cb.autolink || rndr->in_link_body)
 		return 0;
 
+	rndr->autolink_stats.triggers++;
+
+	/* a local part must come right before the '@' */
+	if (!offset || (!isalnum(data[-1]) && !strchr(".+-_", data[-1]))) {
+		rndr->autolink_stats.filtered++;
+		return 0;
+	}
+
 	link = rndr_newbuf(rndr, BUFFER_SPAN);
 
-	if ((link_len = sd_autolink__email(&rewind, link, data, offset, size, 0)) > 0) {
-		ob->size -= rewind;
+	if ((link_len = sd_autolink__email(&rewind, link, data, rndr->text_held.size, size, 0)) > 0) {
+		rndr->autolink_stats.links++;
+		rndr_spend(rndr, link->size - rewind);
+		release_text(ob, rndr, rewind);
 		rndr->cb.autolink(ob, link, MKDA_EMAIL, rndr->opaque);
 	}
 
@@ -826,10 +1486,21 @@ char_autolink_url(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_
 	if (!rndr->cb.autolink || rndr->in_link_body)
 		return 0;
 
+	rndr->autolink_stats.triggers++;
+
+	/* "://" right after the letters of a scheme */
+	if (size < 4 || data[1] != '/' || data[2] != '/' ||
+		!offset || !isalpha(data[-1])) {
+		rndr->autolink_stats.filtered++;
+		return 0;
+	}
+
 	link = rndr_newbuf(rndr, BUFFER_SPAN);
 
-	if ((link_len = sd_autolink__url(&rewind, link, data, offset, size, 0)) > 0) {
-		ob->size -= rewind;
+	if ((link_len = sd_autolink__url(&rewind, link, data, rndr->text_held.size, size, 0)) > 0) {
+		rndr->autolink_stats.links++;
+		rndr_spend(rndr, link->size - rewind);
+		release_text(ob, rndr, rewind);
 		rndr->cb.autolink(ob, link, MKDA_NORMAL, rndr->opaque);
 	}
 
@@ -1044,11 +1715,45 @@ char_link(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offset
 		if (is_img) {
 			bufput(content, data + 1, txt_e - 1);
 		} else {
+			struct span_frame *frame;
+			struct sd_node node;
+
+			/* with enter and leave, the content buffer only */
+			/* holds the unescaped link for the node */
+			if (rndr->events) {
+				node_init(&node, SD_NODE_LINK, 0, span_start(rndr));
+				node_source(&node, data, data + 1,
+					rndr_nesting(rndr) ? 0 : txt_e - 1, data + i);
+				if (link) {
+					unscape_text(content, link);
+					node.link = content;
+				}
+				node.title = title;
+
+				if (!node_enter(rndr, &node, ob)) {
+					ob->size = node.offset;
+					goto cleanup;
+				}
+			}
+
 			/* disable autolinking when parsing inline the
-			 * content of a link */
+			 * content of a link; rendered by close_span */
 			rndr->in_link_body = 1;
-			parse_inline(content, rndr, data + 1, txt_e - 1);
-			rndr->in_link_body = 0;
+
+			frame = push_span(rndr, SPAN_LINK, rndr->events ? ob : content,
+				data + 1, txt_e - 1, data + i);
+			frame->link = link;
+			frame->title = title;
+			frame->org_work_size = org_work_size;
+
+			if (rndr->events) {
+				frame->link = link ? content : NULL;
+				frame->source = data;
+				frame->events = 1;
+				frame->offset = node.offset;
+				frame->parent_offset = node.parent_offset;
+			}
+			return i;
 		}
 	}
 
@@ -1059,7 +1764,7 @@ char_link(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offset
 
 	/* calling the relevant rendering function */
 	if (is_img) {
-		if (ob->size && ob->data[ob->size - 1] == '!')
+		if (ob->size > span_start(rndr) && ob->data[ob->size - 1] == '!')
 			ob->size -= 1;
 
 		ret = rndr->cb.image(ob, u_link, title, content, rndr->opaque);
@@ -1076,8 +1781,7 @@ cleanup:
 static size_t
 char_superscript(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offset, size_t size)
 {
-	size_t sup_start, sup_len;
-	struct buf *sup;
+	size_t sup_start, sup_len, sup_end;
 
 	if (!rndr->cb.superscript)
 		return 0;
@@ -1103,12 +1807,12 @@ char_superscript(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 	if (sup_len - sup_start == 0)
 		return (sup_start == 2) ? 3 : 0;
 
-	sup = rndr_newbuf(rndr, BUFFER_SPAN);
-	parse_inline(sup, rndr, data + sup_start, sup_len - sup_start);
-	rndr->cb.superscript(ob, sup, rndr->opaque);
-	rndr_popbuf(rndr, BUFFER_SPAN);
+	sup_end = (sup_start == 2) ? sup_len + 1 : sup_len;
+	if (!open_span(rndr, SPAN_SUPERSCRIPT, ob,
+			data + sup_start, sup_len - sup_start, data + sup_end))
+		return 0;
 
-	return (sup_start == 2) ? sup_len + 1 : sup_len;
+	return sup_end;
 }
 
 /*********************************
@@ -1378,18 +2082,103 @@ prefix_uli(uint8_t *data, size_t size)
 }
 
 
-/* parse_block • parsing of one block, returning next uint8_t to parse */
-static void parse_block(struct buf *ob, struct sd_markdown *rndr,
-			uint8_t *data, size_t size);
+/* push_block • starts parsing a container block or a sequence of blocks */
+static struct block_frame *
+push_block(struct sd_markdown *rndr, int type, struct buf *ob,
+	struct buf *work, uint8_t *data, size_t size)
+{
+	struct block_frame *frame;
+
+	frame = rndr_newframe(&rndr->block_frames, sizeof(struct block_frame));
+	frame->type = type;
+	frame->ob = ob;
+	frame->work = work;
+	frame->data = data;
+	frame->size = size;
+
+	if (type == BLOCK_SEQUENCE && rndr_nesting(rndr))
+		frame->size = 0;
+
+	return frame;
+}
+
+/* block_start • where the content of the block being parsed starts */
+static inline size_t
+block_start(struct sd_markdown *rndr)
+{
+	struct block_frame *frame = stack_top(&rndr->block_frames);
+	return frame->start;
+}
+
+/* enter_block • opens a container block in the output of its parent */
+/*	its content then goes straight into that output, and its work */
+/*	buffer stays reserved and empty so nesting limits still match */
+static void
+enter_block(struct sd_markdown *rndr, struct block_frame *frame, size_t parent_offset)
+{
+	struct sd_node node;
+
+	node_init(&node, block_node[frame->type], frame->flags, parent_offset);
+	node_enter(rndr, &node, frame->ob);
+
+	frame->events = 1;
+	frame->start = node.content_offset;
+	frame->offset = node.offset;
+	frame->parent_offset = parent_offset;
+}
+
+/* push_content • starts parsing a sequence of blocks inside a container */
+static void
+push_content(struct sd_markdown *rndr, struct block_frame *parent, uint8_t *data, size_t size)
+{
+	struct block_frame *frame;
+
+	frame = push_block(rndr, BLOCK_SEQUENCE,
+		parent->events ? parent->ob : parent->work, NULL, data, size);
+	frame->start = parent->start;
+}
+
+/* work_append • adds a line to a working area compacted in place */
+/*	the area starts on the first line and only ever grows over bytes */
+/*	that have already been scanned, so nothing needs to be copied out */
+static inline void
+work_append(uint8_t **work_data, size_t *work_size, uint8_t *line, size_t size)
+{
+	if (!*work_data)
+		*work_data = line;
+	else if (line != *work_data + *work_size)
+		memmove(*work_data + *work_size, line, size);
+	*work_size += size;
+}
+
+/* work_newline • terminates in-place working data with a newline */
+/*	when the data runs to the very end of the text, it is first moved */
+/*	back over the bytes consumed before it to make room */
+static void
+work_newline(uint8_t *data, uint8_t **work_data, size_t *work_size, size_t size)
+{
+	if (!*work_data || *work_data + *work_size == data + size) {
+		if (*work_data)
+			memmove(data, *work_data, *work_size);
+		*work_data = data;
+	}
+	(*work_data)[(*work_size)++] = '\n';
+}
 
+static void
+htmlblock_reset(struct sd_markdown *rndr);
 
 /* parse_blockquote • handles parsing of a blockquote fragment */
-static size_t
+/*	the quote content is parsed and rendered from block_frames */
+static void
 parse_blockquote(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
 {
-	size_t beg, end = 0, pre, work_size = 0;
+	size_t beg, end = 0, pre, work_size = 0, parent = block_start(rndr);
 	uint8_t *work_data = 0;
 	struct buf *out = 0;
+	struct block_frame *frame;
+
+	RNDR_STATS(rndr->stats.blocks[SD_STATS_BLOCKQUOTE]++);
 
 	out = rndr_newbuf(rndr, BUFFER_BLOCK);
 	beg = 0;
@@ -1407,27 +2196,58 @@ parse_blockquote(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 				!is_empty(data + end, size - end))))
 			break;
 
-		if (beg < end) { /* copy into the in-place working buffer */
-			/* bufput(work, data + beg, end - beg); */
-			if (!work_data)
-				work_data = data + beg;
-			else if (data + beg != work_data + work_size)
-				memmove(work_data + work_size, data + beg, end - beg);
-			work_size += end - beg;
-		}
+		if (beg < end) /* copy into the in-place working buffer */
+			work_append(&work_data, &work_size, data + beg, end - beg);
 		beg = end;
 	}
 
-	parse_block(out, rndr, work_data, work_size);
-	if (rndr->cb.blockquote)
-		rndr->cb.blockquote(ob, out, rndr->opaque);
-	rndr_popbuf(rndr, BUFFER_BLOCK);
-	return end;
+	/* the text was rewritten in place under any cached HTML block */
+	htmlblock_reset(rndr);
+
+	frame = push_block(rndr, BLOCK_QUOTE, ob, out, work_data, work_size);
+	frame->end = end;
+
+	if (rndr->events && rndr->cb.blockquote)
+		enter_block(rndr, frame, parent);
 }
 
 static size_t
 parse_htmlblock(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size, int do_render);
 
+/* parse_textblock • renders the inline content of a paragraph, or of a */
+/*	header when level is set; nothing is parsed when no callback takes */
+/*	the block or any of its spans */
+static void
+parse_textblock(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size, int level)
+{
+	int type = level ? BUFFER_SPAN : BUFFER_BLOCK;
+	int block = (level ? rndr->cb.header != NULL : rndr->cb.paragraph != NULL);
+	struct buf *work;
+	struct sd_node node;
+
+	if (!block && !rndr->spans)
+		return;
+
+	work = rndr_newbuf(rndr, type);
+
+	if (rndr->events && block) {
+		/* the work buffer stays reserved so nesting limits still match */
+		node_init(&node, level ? SD_NODE_HEADER : SD_NODE_PARAGRAPH, level, block_start(rndr));
+		node_enter(rndr, &node, ob);
+		parse_inline(ob, rndr, data, size);
+		rndr->cb.leave(ob, &node, rndr->opaque);
+	} else {
+		parse_inline(work, rndr, data, size);
+
+		if (level && block)
+			rndr->cb.header(ob, work, level, rndr->opaque);
+		else if (block)
+			rndr->cb.paragraph(ob, work, rndr->opaque);
+	}
+
+	rndr_popbuf(rndr, type);
+}
+
 /* parse_blockquote • handles parsing of a regular paragraph */
 static size_t
 parse_paragraph(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
@@ -1436,6 +2256,8 @@ parse_paragraph(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 	int level = 0;
 	struct buf work = { data, 0, 0, 0 };
 
+	RNDR_STATS(rndr->stats.blocks[SD_STATS_PARAGRAPH]++);
+
 	while (i < size) {
 		for (end = i + 1; end < size && data[end - 1] != '\n'; end++) /* empty */;
 
@@ -1491,14 +2313,8 @@ parse_paragraph(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 		work.size--;
 
 	if (!level) {
-		struct buf *tmp = rndr_newbuf(rndr, BUFFER_BLOCK);
-		parse_inline(tmp, rndr, work.data, work.size);
-		if (rndr->cb.paragraph)
-			rndr->cb.paragraph(ob, tmp, rndr->opaque);
-		rndr_popbuf(rndr, BUFFER_BLOCK);
+		parse_textblock(ob, rndr, work.data, work.size, 0);
 	} else {
-		struct buf *header_work;
-
 		if (work.size) {
 			size_t beg;
 			i = work.size;
@@ -1512,43 +2328,34 @@ parse_paragraph(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 				work.size -= 1;
 
 			if (work.size > 0) {
-				struct buf *tmp = rndr_newbuf(rndr, BUFFER_BLOCK);
-				parse_inline(tmp, rndr, work.data, work.size);
-
-				if (rndr->cb.paragraph)
-					rndr->cb.paragraph(ob, tmp, rndr->opaque);
-
-				rndr_popbuf(rndr, BUFFER_BLOCK);
+				parse_textblock(ob, rndr, work.data, work.size, 0);
 				work.data += beg;
 				work.size = i - beg;
 			}
 			else work.size = i;
 		}
 
-		header_work = rndr_newbuf(rndr, BUFFER_SPAN);
-		parse_inline(header_work, rndr, work.data, work.size);
-
-		if (rndr->cb.header)
-			rndr->cb.header(ob, header_work, (int)level, rndr->opaque);
-
-		rndr_popbuf(rndr, BUFFER_SPAN);
+		parse_textblock(ob, rndr, work.data, work.size, level);
 	}
 
 	return end;
 }
 
 /* parse_fencedcode • handles parsing of a block-level code fragment */
+/*	the code is compacted in place and handed over as a view of the text */
 static size_t
 parse_fencedcode(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
 {
 	size_t beg, end;
-	struct buf *work = 0;
+	uint8_t *work_data = 0;
+	size_t work_size = 0;
+	struct buf work = { 0, 0, 0, 0 };
 	struct buf lang = { 0, 0, 0, 0 };
 
 	beg = is_codefence(data, size, &lang);
 	if (beg == 0) return 0;
 
-	work = rndr_newbuf(rndr, BUFFER_BLOCK);
+	RNDR_STATS(rndr->stats.blocks[SD_STATS_FENCEDCODE]++);
 
 	while (beg < size) {
 		size_t fence_end;
@@ -1563,32 +2370,41 @@ parse_fencedcode(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 		for (end = beg + 1; end < size && data[end - 1] != '\n'; end++);
 
 		if (beg < end) {
-			/* verbatim copy to the working buffer,
-				escaping entities */
-			if (is_empty(data + beg, end - beg))
-				bufputc(work, '\n');
-			else bufput(work, data + beg, end - beg);
+			/* blank lines are reduced to their newline */
+			if (is_empty(data + beg, end - beg)) {
+				work_append(&work_data, &work_size, data + beg, 1);
+				work_data[work_size - 1] = '\n';
+			}
+			else work_append(&work_data, &work_size, data + beg, end - beg);
 		}
 		beg = end;
 	}
 
-	if (work->size && work->data[work->size - 1] != '\n')
-		bufputc(work, '\n');
+	if (work_size && work_data[work_size - 1] != '\n')
+		work_newline(data, &work_data, &work_size, size);
 
-	if (rndr->cb.blockcode)
-		rndr->cb.blockcode(ob, work, lang.size ? &lang : NULL, rndr->opaque);
+	work.data = work_data;
+	work.size = work_size;
+
+	if (rndr->cb.blockcode) {
+		work.size = rndr_fit(rndr, work.data, work.size);
+		rndr->cb.blockcode(ob, &work, lang.size ? &lang : NULL, rndr->opaque);
+	}
 
-	rndr_popbuf(rndr, BUFFER_BLOCK);
 	return beg;
 }
 
+/* parse_blockcode • handles parsing of an indented code block */
+/*	the code is compacted in place and handed over as a view of the text */
 static size_t
 parse_blockcode(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
 {
 	size_t beg, end, pre;
-	struct buf *work = 0;
+	uint8_t *work_data = 0;
+	size_t work_size = 0;
+	struct buf work = { 0, 0, 0, 0 };
 
-	work = rndr_newbuf(rndr, BUFFER_BLOCK);
+	RNDR_STATS(rndr->stats.blocks[SD_STATS_CODE]++);
 
 	beg = 0;
 	while (beg < size) {
@@ -1602,34 +2418,43 @@ parse_blockcode(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 			break;
 
 		if (beg < end) {
-			/* verbatim copy to the working buffer,
-				escaping entities */
-			if (is_empty(data + beg, end - beg))
-				bufputc(work, '\n');
-			else bufput(work, data + beg, end - beg);
+			/* blank lines are reduced to their newline */
+			if (is_empty(data + beg, end - beg)) {
+				work_append(&work_data, &work_size, data + beg, 1);
+				work_data[work_size - 1] = '\n';
+			}
+			else work_append(&work_data, &work_size, data + beg, end - beg);
 		}
 		beg = end;
 	}
 
-	while (work->size && work->data[work->size - 1] == '\n')
-		work->size -= 1;
+	while (work_size && work_data[work_size - 1] == '\n')
+		work_size -= 1;
 
-	bufputc(work, '\n');
+	work_newline(data, &work_data, &work_size, size);
 
-	if (rndr->cb.blockcode)
-		rndr->cb.blockcode(ob, work, NULL, rndr->opaque);
+	work.data = work_data;
+	work.size = work_size;
+
+	if (rndr->cb.blockcode) {
+		work.size = rndr_fit(rndr, work.data, work.size);
+		rndr->cb.blockcode(ob, &work, NULL, rndr->opaque);
+	}
 
-	rndr_popbuf(rndr, BUFFER_BLOCK);
 	return beg;
 }
 
 /* parse_listitem • parsing of a single list item */
-/*	assuming initial prefix is already removed */
+/*	assuming initial prefix is already removed; the item content is */
+/*	parsed and rendered from block_frames */
 static size_t
 parse_listitem(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size, int *flags)
 {
-	struct buf *work = 0, *inter = 0;
-	size_t beg = 0, end, pre, sublist = 0, orgpre = 0, i;
+	struct buf *inter = 0;
+	struct block_frame *frame;
+	uint8_t *work_data = 0;
+	size_t work_size = 0, beg = 0, end, pre, sublist = 0, orgpre = 0, i;
+	size_t parent = block_start(rndr);
 	int in_empty = 0, has_inside_empty = 0, in_fence = 0;
 
 	/* keeping track of the first indentation prefix */
@@ -1643,17 +2468,19 @@ parse_listitem(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t s
 	if (!beg)
 		return 0;
 
+	RNDR_STATS(rndr->stats.blocks[SD_STATS_LISTITEM]++);
+
 	/* skipping to the beginning of the following line */
 	end = beg;
 	while (end < size && data[end - 1] != '\n')
 		end++;
 
 	/* getting working buffers */
-	work = rndr_newbuf(rndr, BUFFER_SPAN);
 	inter = rndr_newbuf(rndr, BUFFER_SPAN);
 
-	/* putting the first line into the working buffer */
-	bufput(work, data + beg, end - beg);
+	/* the item body is compacted in place, starting on the first line; */
+	/* skipped blank lines always leave room for the '\n' put back */
+	work_append(&work_data, &work_size, data + beg, end - beg);
 	beg = end;
 
 	/* process the following lines */
@@ -1708,7 +2535,7 @@ parse_listitem(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t s
 				break;             /* the same indentation */
 
 			if (!sublist)
-				sublist = work->size;
+				sublist = work_size;
 		}
 		/* joining only indented stuff after empty lines;
 		 * note that now we only require 1 space of indentation
@@ -1718,14 +2545,14 @@ parse_listitem(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t s
 			break;
 		}
 		else if (in_empty) {
-			bufputc(work, '\n');
+			work_data[work_size++] = '\n';
 			has_inside_empty = 1;
 		}
 
 		in_empty = 0;
 
 		/* adding the line without prefix into the working buffer */
-		bufput(work, data + beg + i, end - beg - i);
+		work_append(&work_data, &work_size, data + beg + i, end - beg - i);
 		beg = end;
 	}
 
@@ -1733,55 +2560,33 @@ parse_listitem(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t s
 	if (has_inside_empty)
 		*flags |= MKD_LI_BLOCK;
 
-	if (*flags & MKD_LI_BLOCK) {
-		/* intermediate render of block li */
-		if (sublist && sublist < work->size) {
-			parse_block(inter, rndr, work->data, sublist);
-			parse_block(inter, rndr, work->data + sublist, work->size - sublist);
-		}
-		else
-			parse_block(inter, rndr, work->data, work->size);
-	} else {
-		/* intermediate render of inline li */
-		if (sublist && sublist < work->size) {
-			parse_inline(inter, rndr, work->data, sublist);
-			parse_block(inter, rndr, work->data + sublist, work->size - sublist);
-		}
-		else
-			parse_inline(inter, rndr, work->data, work->size);
-	}
+	htmlblock_reset(rndr);
 
-	/* render of li itself */
-	if (rndr->cb.listitem)
-		rndr->cb.listitem(ob, inter, *flags, rndr->opaque);
+	frame = push_block(rndr, BLOCK_LISTITEM, ob, inter, work_data, work_size);
+	frame->flags = *flags;
+	frame->sublist = (sublist && sublist < work_size) ? sublist : work_size;
+
+	if (rndr->events && rndr->cb.listitem)
+		enter_block(rndr, frame, parent);
 
-	rndr_popbuf(rndr, BUFFER_SPAN);
-	rndr_popbuf(rndr, BUFFER_SPAN);
 	return beg;
 }
 
 
 /* parse_list • parsing ordered or unordered list block */
-static size_t
+/*	the items are parsed and rendered from block_frames */
+static void
 parse_list(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size, int flags)
 {
-	struct buf *work = 0;
-	size_t i = 0, j;
+	struct block_frame *frame;
+	size_t parent = block_start(rndr);
 
-	work = rndr_newbuf(rndr, BUFFER_BLOCK);
+	RNDR_STATS(rndr->stats.blocks[SD_STATS_LIST]++);
+	frame = push_block(rndr, BLOCK_LIST, ob, rndr_newbuf(rndr, BUFFER_BLOCK), data, size);
+	frame->flags = flags;
 
-	while (i < size) {
-		j = parse_listitem(work, rndr, data + i, size - i, &flags);
-		i += j;
-
-		if (!j || (flags & MKD_LI_END))
-			break;
-	}
-
-	if (rndr->cb.list)
-		rndr->cb.list(ob, work, flags, rndr->opaque);
-	rndr_popbuf(rndr, BUFFER_BLOCK);
-	return i;
+	if (rndr->events && rndr->cb.list)
+		enter_block(rndr, frame, parent);
 }
 
 /* parse_atxheader • parsing of atx-style headers */
@@ -1791,6 +2596,8 @@ parse_atxheader(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 	size_t level = 0;
 	size_t i, end, skip;
 
+	RNDR_STATS(rndr->stats.blocks[SD_STATS_HEADER]++);
+
 	while (level < size && level < 6 && data[level] == '#')
 		level++;
 
@@ -1805,16 +2612,8 @@ parse_atxheader(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 	while (end && data[end - 1] == ' ')
 		end--;
 
-	if (end > i) {
-		struct buf *work = rndr_newbuf(rndr, BUFFER_SPAN);
-
-		parse_inline(work, rndr, data + i, end - i);
-
-		if (rndr->cb.header)
-			rndr->cb.header(ob, work, (int)level, rndr->opaque);
-
-		rndr_popbuf(rndr, BUFFER_SPAN);
-	}
+	if (end > i)
+		parse_textblock(ob, rndr, data + i, end - i, (int)level);
 
 	return skip;
 }
@@ -1894,13 +2693,43 @@ htmlblock_end(const char *curtag,
 }
 
 
-/* parse_htmlblock • parsing of inline HTML block */
+/* htmlblock_missed • whether a closing tag search is known to fail */
+/*	a search that found nothing from data to the end also finds nothing */
+/*	from any later point of the same data */
+static int
+htmlblock_missed(struct sd_markdown *rndr, const char *tag, uint8_t *data, size_t size)
+{
+	struct html_miss *miss = &rndr->html_misses[(tag[0] + tag[1]) % HTML_MISS_SIZE];
+
+	return miss->tag == tag && miss->end == data + size && miss->from <= data;
+}
+
+static void
+htmlblock_miss(struct sd_markdown *rndr, const char *tag, uint8_t *data, size_t size)
+{
+	struct html_miss *miss = &rndr->html_misses[(tag[0] + tag[1]) % HTML_MISS_SIZE];
+
+	miss->tag = tag;
+	miss->from = data;
+	miss->end = data + size;
+}
+
+/* htmlblock_reset • forgets cached HTML block results */
+/*	to be called whenever the text is rewritten in place */
+static void
+htmlblock_reset(struct sd_markdown *rndr)
+{
+	memset(&rndr->html_last, 0x0, sizeof(rndr->html_last));
+	memset(rndr->html_misses, 0x0, sizeof(rndr->html_misses));
+}
+
+/* htmlblock_len • returns the length of the HTML block at data, 0 if none */
 static size_t
-parse_htmlblock(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size, int do_render)
+htmlblock_len(struct sd_markdown *rndr, uint8_t *data, size_t size)
 {
+	static const char *comment_tag = "!--";
 	size_t i, j = 0, tag_end;
 	const char *curtag = NULL;
-	struct buf work = { data, 0, 0, 0 };
 
 	/* identification of the opening tag */
 	if (size < 2 || data[0] != '<')
@@ -1917,23 +2746,23 @@ parse_htmlblock(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 	if (!curtag) {
 
 		/* HTML comment, laxist form */
-		if (size > 5 && data[1] == '!' && data[2] == '-' && data[3] == '-') {
+		if (size > 5 && data[1] == '!' && data[2] == '-' && data[3] == '-' &&
+			!htmlblock_missed(rndr, comment_tag, data, size)) {
 			i = 5;
 
 			while (i < size && !(data[i - 2] == '-' && data[i - 1] == '-' && data[i] == '>'))
 				i++;
 
+			if (i >= size)
+				htmlblock_miss(rndr, comment_tag, data, size);
+
 			i++;
 
 			if (i < size)
 				j = is_empty(data + i, size - i);
 
-			if (j) {
-				work.size = i + j;
-				if (do_render && rndr->cb.blockhtml)
-					rndr->cb.blockhtml(ob, &work, rndr->opaque);
-				return work.size;
-			}
+			if (j)
+				return i + j;
 		}
 
 		/* HR, which is the only self-closing block tag considered */
@@ -1945,12 +2774,8 @@ parse_htmlblock(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 			if (i + 1 < size) {
 				i++;
 				j = is_empty(data + i, size - i);
-				if (j) {
-					work.size = i + j;
-					if (do_render && rndr->cb.blockhtml)
-						rndr->cb.blockhtml(ob, &work, rndr->opaque);
-					return work.size;
-				}
+				if (j)
+					return i + j;
 			}
 		}
 
@@ -1958,6 +2783,9 @@ parse_htmlblock(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 		return 0;
 	}
 
+	if (htmlblock_missed(rndr, curtag, data, size))
+		return 0;
+
 	/* looking for an unindented matching closing tag */
 	/*	followed by a blank line */
 	tag_end = htmlblock_end(curtag, rndr, data, size, 1);
@@ -1966,17 +2794,37 @@ parse_htmlblock(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 	/* but not if tag is "ins" or "del" (following original Markdown.pl) */
 	if (!tag_end && strcmp(curtag, "ins") != 0 && strcmp(curtag, "del") != 0) {
 		tag_end = htmlblock_end(curtag, rndr, data, size, 0);
+
+		/* the indented pass accepts any closing tag, so this
+		 * is a miss for every later block with this tag */
+		if (!tag_end)
+			htmlblock_miss(rndr, curtag, data, size);
 	}
 
-	if (!tag_end)
-		return 0;
+	return tag_end;
+}
+
+/* parse_htmlblock • parsing of inline HTML block */
+/*	the last block measured is remembered, since parse_paragraph probes */
+/*	for the very block parse_block renders right after */
+static size_t
+parse_htmlblock(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size, int do_render)
+{
+	struct buf work = { data, 0, 0, 0 };
+
+	if (rndr->html_last.data != data || rndr->html_last.size != size) {
+		rndr->html_last.data = data;
+		rndr->html_last.size = size;
+		rndr->html_last.len = htmlblock_len(rndr, data, size);
+	}
 
-	/* the end of the block has been found */
-	work.size = tag_end;
-	if (do_render && rndr->cb.blockhtml)
+	work.size = rndr->html_last.len;
+	RNDR_STATS(rndr->stats.blocks[SD_STATS_HTML] += (work.size && do_render));
+
+	if (work.size && do_render && rndr->cb.blockhtml)
 		rndr->cb.blockhtml(ob, &work, rndr->opaque);
 
-	return tag_end;
+	return work.size;
 }
 
 static void
@@ -1987,24 +2835,31 @@ parse_table_row(
 	size_t size,
 	size_t columns,
 	int *col_data,
-	int header_flag)
+	int header_flag,
+	const struct sd_node *parent)
 {
 	size_t i = 0, col;
-	struct buf *row_work = 0;
+	struct buf *row_work = 0, *cell_work = 0;
+	struct sd_node row, cell;
 
 	if (!rndr->cb.table_cell || !rndr->cb.table_row)
 		return;
 
 	row_work = rndr_newbuf(rndr, BUFFER_SPAN);
+	cell_work = rndr_newbuf(rndr, BUFFER_SPAN);
+
+	/* with a parent node, cells go straight into ob between enter */
+	/* and leave, and the work buffers stay reserved and empty */
+	if (parent) {
+		node_init(&row, SD_NODE_TABLE_ROW, 0, parent->content_offset);
+		node_enter(rndr, &row, ob);
+	}
 
 	if (i < size && data[i] == '|')
 		i++;
 
 	for (col = 0; col < columns && i < size; ++col) {
 		size_t cell_start, cell_end;
-		struct buf *cell_work;
-
-		cell_work = rndr_newbuf(rndr, BUFFER_SPAN);
 
 		while (i < size && _isspace(data[i]))
 			i++;
@@ -2019,31 +2874,51 @@ parse_table_row(
 		while (cell_end > cell_start && _isspace(data[cell_end]))
 			cell_end--;
 
-		parse_inline(cell_work, rndr, data + cell_start, 1 + cell_end - cell_start);
-		rndr->cb.table_cell(row_work, cell_work, col_data[col] | header_flag, rndr->opaque);
+		if (parent) {
+			node_init(&cell, SD_NODE_TABLE_CELL, col_data[col] | header_flag, row.content_offset);
+			node_enter(rndr, &cell, ob);
+			parse_inline(ob, rndr, data + cell_start, 1 + cell_end - cell_start);
+			rndr->cb.leave(ob, &cell, rndr->opaque);
+		} else {
+			/* every cell of the row is parsed into the same scratch buffer */
+			cell_work->size = 0;
+			parse_inline(cell_work, rndr, data + cell_start, 1 + cell_end - cell_start);
+			rndr->cb.table_cell(row_work, cell_work, col_data[col] | header_flag, rndr->opaque);
+		}
 
-		rndr_popbuf(rndr, BUFFER_SPAN);
 		i++;
 	}
 
 	for (; col < columns; ++col) {
 		struct buf empty_cell = { 0, 0, 0, 0 };
-		rndr->cb.table_cell(row_work, &empty_cell, col_data[col] | header_flag, rndr->opaque);
+
+		if (parent) {
+			node_init(&cell, SD_NODE_TABLE_CELL, col_data[col] | header_flag, row.content_offset);
+			node_enter(rndr, &cell, ob);
+			rndr->cb.leave(ob, &cell, rndr->opaque);
+		} else
+			rndr->cb.table_cell(row_work, &empty_cell, col_data[col] | header_flag, rndr->opaque);
 	}
 
-	rndr->cb.table_row(ob, row_work, rndr->opaque);
+	if (parent)
+		rndr->cb.leave(ob, &row, rndr->opaque);
+	else
+		rndr->cb.table_row(ob, row_work, rndr->opaque);
 
 	rndr_popbuf(rndr, BUFFER_SPAN);
+	rndr_popbuf(rndr, BUFFER_SPAN);
 }
 
+/* is_tableheader • checks for a header row followed by its underline */
+/*	returns the offset of the first body row, 0 if this is not a table; */
+/*	column alignments are only stored when column_data is given */
 static size_t
-parse_table_header(
-	struct buf *ob,
-	struct sd_markdown *rndr,
+is_tableheader(
 	uint8_t *data,
 	size_t size,
 	size_t *columns,
-	int **column_data)
+	size_t *header_size,
+	int *column_data)
 {
 	int pipes;
 	size_t i = 0, col, header_end, under_end;
@@ -2068,7 +2943,7 @@ parse_table_header(
 		pipes--;
 
 	*columns = pipes + 1;
-	*column_data = calloc(*columns, sizeof(int));
+	*header_size = header_end;
 
 	/* Parse the header underline */
 	i++;
@@ -2086,8 +2961,9 @@ parse_table_header(
 			i++;
 
 		if (data[i] == ':') {
-			i++; (*column_data)[col] |= MKD_TABLE_ALIGN_L;
-			dashes++;
+			i++; dashes++;
+			if (column_data)
+				column_data[col] |= MKD_TABLE_ALIGN_L;
 		}
 
 		while (i < under_end && data[i] == '-') {
@@ -2095,8 +2971,9 @@ parse_table_header(
 		}
 
 		if (i < under_end && data[i] == ':') {
-			i++; (*column_data)[col] |= MKD_TABLE_ALIGN_R;
-			dashes++;
+			i++; dashes++;
+			if (column_data)
+				column_data[col] |= MKD_TABLE_ALIGN_R;
 		}
 
 		while (i < under_end && data[i] == ' ')
@@ -2114,14 +2991,6 @@ parse_table_header(
 	if (col < *columns)
 		return 0;
 
-	parse_table_row(
-		ob, rndr, data,
-		header_end,
-		*columns,
-		*column_data,
-		MKD_TABLE_HEADER
-	);
-
 	return under_end + 1;
 }
 
@@ -2136,80 +3005,146 @@ parse_table(
 
 	struct buf *header_work = 0;
 	struct buf *body_work = 0;
+	struct buf *row_out;
+	struct sd_node table, part, *row_parent = NULL;
 
-	size_t columns;
+	size_t columns, header_end;
 	int *col_data = NULL;
 
+	/* probing without allocating anything, most blocks are not tables */
+	i = is_tableheader(data, size, &columns, &header_end, NULL);
+	if (i == 0)
+		return 0;
+
+	RNDR_STATS(rndr->stats.blocks[SD_STATS_TABLE]++);
+	col_data = calloc(columns, sizeof(int));
+	is_tableheader(data, size, &columns, &header_end, col_data);
+
 	header_work = rndr_newbuf(rndr, BUFFER_SPAN);
 	body_work = rndr_newbuf(rndr, BUFFER_BLOCK);
 
-	i = parse_table_header(header_work, rndr, data, size, &columns, &col_data);
-	if (i > 0) {
+	/* with enter and leave, the whole table is rendered in place */
+	if (rndr->events && rndr->cb.table) {
+		node_init(&table, SD_NODE_TABLE, 0, block_start(rndr));
+		node_enter(rndr, &table, ob);
+		node_init(&part, SD_NODE_TABLE_HEAD, 0, table.content_offset);
+		node_enter(rndr, &part, ob);
+		row_parent = &part;
+	}
 
-		while (i < size) {
-			size_t row_start;
-			int pipes = 0;
+	parse_table_row(
+		row_parent ? ob : header_work, rndr, data,
+		header_end,
+		columns,
+		col_data,
+		MKD_TABLE_HEADER,
+		row_parent
+	);
 
-			row_start = i;
+	/* when streaming, rows go straight into the output; the body buffer */
+	/* stays reserved and empty so nesting limits match the buffered path */
+	if (row_parent) {
+		rndr->cb.leave(ob, &part, rndr->opaque);
+		node_init(&part, SD_NODE_TABLE_BODY, 0, table.content_offset);
+		node_enter(rndr, &part, ob);
+		row_out = ob;
+	} else if (rndr->cb.table_begin) {
+		rndr->cb.table_begin(ob, header_work, rndr->opaque);
+		row_out = ob;
+	} else {
+		row_out = body_work;
+	}
 
-			while (i < size && data[i] != '\n')
-				if (data[i++] == '|')
-					pipes++;
+	/* rows are left out once the budget is spent */
+	while (i < size && rndr->budget > 0) {
+		size_t row_start;
+		int pipes = 0;
 
-			if (pipes == 0 || i == size) {
-				i = row_start;
-				break;
-			}
+		row_start = i;
 
-			parse_table_row(
-				body_work,
-				rndr,
-				data + row_start,
-				i - row_start,
-				columns,
-				col_data, 0
-			);
+		while (i < size && data[i] != '\n')
+			if (data[i++] == '|')
+				pipes++;
 
-			i++;
+		if (pipes == 0 || i == size) {
+			i = row_start;
+			break;
 		}
 
-		if (rndr->cb.table)
-			rndr->cb.table(ob, header_work, body_work, rndr->opaque);
+		parse_table_row(
+			row_out,
+			rndr,
+			data + row_start,
+			i - row_start,
+			columns,
+			col_data, 0,
+			row_parent
+		);
+
+		i++;
 	}
 
+	if (row_parent) {
+		rndr->cb.leave(ob, &part, rndr->opaque);
+		rndr->cb.leave(ob, &table, rndr->opaque);
+	} else if (rndr->cb.table_begin) {
+		if (rndr->cb.table_end)
+			rndr->cb.table_end(ob, rndr->opaque);
+	} else if (rndr->cb.table)
+		rndr->cb.table(ob, header_work, body_work, rndr->opaque);
+
 	free(col_data);
 	rndr_popbuf(rndr, BUFFER_SPAN);
 	rndr_popbuf(rndr, BUFFER_BLOCK);
 	return i;
 }
 
-/* parse_block • parsing of one block, returning next uint8_t to parse */
-static void
-parse_block(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
+/* parse_sequence • parses a sequence of blocks until it is over, returning */
+/*	1, or until a container block is pushed, returning 0 */
+static int
+parse_sequence(struct sd_markdown *rndr, struct block_frame *frame)
 {
-	size_t beg, end, i;
+	struct buf *ob = frame->ob;
+	uint8_t *data = frame->data;
+	size_t beg = frame->beg, size = frame->size, end, i, depth;
+	unsigned int block;
 	uint8_t *txt_data;
-	beg = 0;
-
-	if (rndr->work_bufs[BUFFER_SPAN].size +
-		rndr->work_bufs[BUFFER_BLOCK].size > rndr->max_nesting)
-		return;
 
 	while (beg < size) {
+		depth = rndr->block_frames.size;
 		txt_data = data + beg;
 		end = size - beg;
 
-		if (is_atxheader(rndr, txt_data, end))
+		/* blocks are left out once the budget is spent */
+		if (rndr->budget == 0 && !is_empty(txt_data, end))
+			rndr->stopped = 1;
+
+		if (rndr_step(rndr))
+			break;
+
+		/* the first non-space char tells which parsers may match */
+		for (i = 0; i < end && txt_data[i] == ' '; i++);
+		block = rndr->block_char[i < end ? txt_data[i] : '\n'];
+
+		if (i > 0)
+			block &= ~(MD_BLOCK_ATX | MD_BLOCK_HTML);
+
+		if (i > 3)
+			block = (block & MD_BLOCK_EMPTY) | MD_BLOCK_CODE;
+
+		if ((block & MD_BLOCK_ATX) && is_atxheader(rndr, txt_data, end))
 			beg += parse_atxheader(ob, rndr, txt_data, end);
 
-		else if (data[beg] == '<' && rndr->cb.blockhtml &&
+		else if ((block & MD_BLOCK_HTML) &&
 				(i = parse_htmlblock(ob, rndr, txt_data, end, 1)) != 0)
 			beg += i;
 
-		else if ((i = is_empty(txt_data, end)) != 0)
+		else if ((block & MD_BLOCK_EMPTY) &&
+				(i = is_empty(txt_data, end)) != 0)
 			beg += i;
 
-		else if (is_hrule(txt_data, end)) {
+		else if ((block & MD_BLOCK_HRULE) && is_hrule(txt_data, end)) {
+			RNDR_STATS(rndr->stats.blocks[SD_STATS_HRULE]++);
 			if (rndr->cb.hrule)
 				rndr->cb.hrule(ob, rndr->opaque);
 
@@ -2219,7 +3154,7 @@ parse_block(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size
 			beg++;
 		}
 
-		else if ((rndr->ext_flags & MKDEXT_FENCED_CODE) != 0 &&
+		else if ((block & MD_BLOCK_FENCE) &&
 			(i = parse_fencedcode(ob, rndr, txt_data, end)) != 0)
 			beg += i;
 
@@ -2227,23 +3162,373 @@ parse_block(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size
 			(i = parse_table(ob, rndr, txt_data, end)) != 0)
 			beg += i;
 
-		else if (prefix_quote(txt_data, end))
-			beg += parse_blockquote(ob, rndr, txt_data, end);
+		/* container blocks move beg forward when closed */
+		else if ((block & MD_BLOCK_QUOTE) && prefix_quote(txt_data, end))
+			parse_blockquote(ob, rndr, txt_data, end);
 
-		else if (prefix_code(txt_data, end))
+		else if ((block & MD_BLOCK_CODE) && prefix_code(txt_data, end))
 			beg += parse_blockcode(ob, rndr, txt_data, end);
 
-		else if (prefix_uli(txt_data, end))
-			beg += parse_list(ob, rndr, txt_data, end, 0);
+		else if ((block & MD_BLOCK_ULI) && prefix_uli(txt_data, end))
+			parse_list(ob, rndr, txt_data, end, 0);
 
-		else if (prefix_oli(txt_data, end))
-			beg += parse_list(ob, rndr, txt_data, end, MKD_LIST_ORDERED);
+		else if ((block & MD_BLOCK_OLI) && prefix_oli(txt_data, end))
+			parse_list(ob, rndr, txt_data, end, MKD_LIST_ORDERED);
 
 		else
 			beg += parse_paragraph(ob, rndr, txt_data, end);
+
+		if (rndr->block_frames.size > depth) {
+			frame->beg = beg;
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/* parse_container • parses the content of a container block until it is */
+/*	over, returning 1, or until a nested block is pushed, returning 0 */
+static int
+parse_container(struct sd_markdown *rndr, struct block_frame *frame)
+{
+	size_t depth = rndr->block_frames.size, j;
+
+	switch (frame->type) {
+	case BLOCK_QUOTE:
+		if (frame->stage++ == 0)
+			push_content(rndr, frame, frame->data, frame->size);
+		break;
+
+	case BLOCK_LIST:
+		while (!frame->stage && frame->beg < frame->size &&
+				rndr->budget > 0 && !rndr_step(rndr)) {
+			j = parse_listitem(frame->events ? frame->ob : frame->work, rndr,
+				frame->data + frame->beg, frame->size - frame->beg, &frame->flags);
+			frame->beg += j;
+
+			if (!j || (frame->flags & MKD_LI_END))
+				frame->stage = 1;
+
+			if (rndr->block_frames.size > depth)
+				break;
+		}
+		break;
+
+	case BLOCK_LISTITEM:
+		/* the item is split in two when it contains a sublist */
+		while (frame->stage < 2 && rndr->block_frames.size == depth) {
+			if (frame->stage++ == 0) {
+				if (frame->flags & MKD_LI_BLOCK)
+					push_content(rndr, frame, frame->data, frame->sublist);
+				else
+					parse_inline(frame->events ? frame->ob : frame->work,
+						rndr, frame->data, frame->sublist);
+			}
+			else if (frame->sublist < frame->size)
+				push_content(rndr, frame,
+					frame->data + frame->sublist, frame->size - frame->sublist);
+		}
+		break;
+	}
+
+	return rndr->block_frames.size == depth;
+}
+
+/* close_block • renders a parsed container block */
+static void
+close_block(struct sd_markdown *rndr, struct block_frame *frame, struct block_frame *parent)
+{
+	struct sd_node node;
+
+	if (frame->events) {
+		node_init(&node, block_node[frame->type], frame->flags, frame->parent_offset);
+		node.offset = frame->offset;
+		node.content_offset = frame->start;
+		rndr->cb.leave(frame->ob, &node, rndr->opaque);
+	}
+
+	switch (frame->type) {
+	case BLOCK_QUOTE:
+		if (!frame->events && rndr->cb.blockquote)
+			rndr->cb.blockquote(frame->ob, frame->work, rndr->opaque);
+		rndr_popbuf(rndr, BUFFER_BLOCK);
+		parent->beg += frame->end;
+		break;
+
+	case BLOCK_LIST:
+		if (!frame->events && rndr->cb.list)
+			rndr->cb.list(frame->ob, frame->work, frame->flags, rndr->opaque);
+		rndr_popbuf(rndr, BUFFER_BLOCK);
+		parent->beg += frame->beg;
+		break;
+
+	case BLOCK_LISTITEM:
+		if (!frame->events && rndr->cb.listitem)
+			rndr->cb.listitem(frame->ob, frame->work, frame->flags, rndr->opaque);
+		rndr_popbuf(rndr, BUFFER_SPAN);
+		break;
+	}
+}
+
+/* parse_block • parses a sequence of blocks into ob */
+/*	container blocks are not parsed recursively: they push a frame on */
+/*	block_frames, so nesting costs heap, not stack */
+static void
+parse_block(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
+{
+	size_t base = rndr->block_frames.size;
+	struct block_frame *frame;
+	int done;
+
+	push_block(rndr, BLOCK_SEQUENCE, ob, NULL, data, size);
+
+	while (rndr->block_frames.size > base) {
+		frame = stack_top(&rndr->block_frames);
+
+		if (frame->type == BLOCK_SEQUENCE)
+			done = parse_sequence(rndr, frame);
+		else
+			done = parse_container(rndr, frame);
+
+		if (!done)
+			continue;
+
+		rndr->block_frames.size--;
+		if (frame->type != BLOCK_SEQUENCE)
+			close_block(rndr, frame, stack_top(&rndr->block_frames));
+	}
+}
+
+
+
+/* atx_level • level of an atx header, 0 when it has no content and */
+/*	parse_atxheader renders nothing */
+static int
+atx_level(uint8_t *data, size_t size)
+{
+	size_t level = 0, i, end;
+
+	while (level < size && level < 6 && data[level] == '#')
+		level++;
+
+	for (i = level; i < size && data[i] == ' '; i++);
+	for (end = i; end < size && data[end] != '\n'; end++);
+
+	while (end && data[end - 1] == '#')
+		end--;
+
+	while (end && data[end - 1] == ' ')
+		end--;
+
+	return end > i ? (int)level : 0;
+}
+
+/* item_indent • indentation kept by parse_listitem for the first line */
+static size_t
+item_indent(uint8_t *data, size_t size)
+{
+	size_t i = 0;
+
+	while (i < 3 && i < size && data[i] == ' ')
+		i++;
+
+	return i;
+}
+
+/* section_listline • whether the line from i to next goes on the list */
+/*	being scanned, as parse_listitem and parse_list tell; empty is set */
+/*	after an empty line, and a line starting an item resets the state */
+/*	kept for it */
+static int
+section_listline(struct sd_markdown *rndr, uint8_t *data, size_t size, size_t i, size_t next,
+	int empty, int ordered, size_t *orgpre, int *in_fence)
+{
+	size_t n, has_next_uli = 0, has_next_oli = 0;
+
+	for (n = 0; n < 4 && i + n < next && data[i + n] == ' '; n++);
+
+	if ((rndr->ext_flags & MKDEXT_FENCED_CODE) &&
+		is_codefence(data + i + n, next - i - n, NULL) != 0)
+		*in_fence = !*in_fence;
+
+	if (!*in_fence) {
+		has_next_uli = prefix_uli(data + i + n, next - i - n);
+		has_next_oli = prefix_oli(data + i + n, next - i - n);
+	}
+
+	/* the following item must have the same list type */
+	if (empty && (ordered ? has_next_uli : has_next_oli))
+		return 0;
+
+	if ((has_next_uli && !is_hrule(data + i + n, next - i - n)) || has_next_oli) {
+		if (n != *orgpre)
+			return 1;
+
+		/* a new item, unless its line is read as a setext header */
+		if (!prefix_uli(data + i, size - i) && !prefix_oli(data + i, size - i))
+			return 0;
+
+		*orgpre = item_indent(data + i, size - i);
+		*in_fence = 0;
+		return 1;
 	}
+
+	return !empty || n > 0;
 }
 
+/* scan states of find_section */
+enum section_state {
+	SECTION_BLOCK,
+	SECTION_PARAGRAPH,
+	SECTION_LIST,
+	SECTION_QUOTE,
+};
+
+/* find_section • locates the index-th header at the top level of the text */
+/*	and the blocks after it, up to the next header of its level or above; */
+/*	lines are told apart by their start, as parse_sequence and */
+/*	parse_paragraph do, and no inline markdown is parsed; setext is set */
+/*	when the header is underlined, and only parse_paragraph reads it */
+/*	as one */
+static int
+find_section(struct sd_markdown *rndr, uint8_t *data, size_t size,
+	size_t index, size_t *beg, size_t *end, int *setext)
+{
+	size_t i = 0, line, next, last = 0, count = 0, n, columns, header_end, pipes, orgpre = 0;
+	int state = SECTION_BLOCK, empty = 0, ordered = 0, in_fence = 0, level, underlined, found = 0;
+	struct buf trail = { 0, 0, 0, 0 };
+
+	while (i < size) {
+		for (next = i + 1; next < size && data[next - 1] != '\n'; next++);
+		line = i;
+		level = 0;
+		underlined = 0;
+
+		if (is_empty(data + i, size - i)) {
+			if (state == SECTION_PARAGRAPH)
+				state = SECTION_BLOCK;
+			empty = 1;
+			i = next;
+			continue;
+		}
+
+		/* a quote goes on until an empty line comes before a line out */
+		/* of it, as in parse_blockquote */
+		if (state == SECTION_LIST &&
+			!section_listline(rndr, data, size, i, next, empty, ordered, &orgpre, &in_fence))
+			state = SECTION_BLOCK;
+		else if (state == SECTION_QUOTE && empty && !prefix_quote(data + i, size - i))
+			state = SECTION_BLOCK;
+
+		empty = 0;
+
+		if (state == SECTION_LIST || state == SECTION_QUOTE) {
+			i = next;
+			continue;
+		}
+
+		if (state == SECTION_PARAGRAPH) {
+			if ((level = is_headerline(data + i, size - i)) == 0 &&
+				!is_atxheader(rndr, data + i, size - i) &&
+				!is_hrule(data + i, size - i) &&
+				!prefix_quote(data + i, size - i) &&
+				!((rndr->ext_flags & MKDEXT_LAX_SPACING) && !isalnum(data[i]) &&
+					(prefix_oli(data + i, size - i) || prefix_uli(data + i, size - i) ||
+					(data[i] == '<' && rndr->cb.blockhtml &&
+						parse_htmlblock(NULL, rndr, data + i, size - i, 0)) ||
+					((rndr->ext_flags & MKDEXT_FENCED_CODE) &&
+						is_codefence(data + i, size - i, NULL))))) {
+				last = i;
+				i = next;
+				continue;
+			}
+		}
+
+		state = SECTION_BLOCK;
+
+		/* a setext header was found above, the other blocks start here */
+		if (level) {
+			line = last;
+			underlined = 1;
+		}
+
+		else if (is_atxheader(rndr, data + i, size - i))
+			level = atx_level(data + i, size - i);
+
+		else if (data[i] == '<' && rndr->cb.blockhtml &&
+				(n = parse_htmlblock(NULL, rndr, data + i, size - i, 0)) != 0)
+			next = i + n;
+
+		else if (prefix_code(data + i, size - i) || is_hrule(data + i, size - i))
+			state = SECTION_BLOCK;
+
+		else if ((rndr->ext_flags & MKDEXT_FENCED_CODE) &&
+				(n = is_codefence(data + i, size - i, NULL)) != 0) {
+			/* skipping to the closing fence, which has no syntax */
+			for (next = i + n; next < size; ) {
+				n = is_codefence(data + next, size - next, &trail);
+				if (n && trail.size == 0) {
+					next += n;
+					break;
+				}
+
+				while (next < size && data[next++] != '\n');
+			}
+		}
+
+		else if ((rndr->ext_flags & MKDEXT_TABLES) &&
+				(n = is_tableheader(data + i, size - i, &columns, &header_end, NULL)) != 0) {
+			/* rows go on while their line holds a pipe */
+			for (next = i + n; next < size; next = line + 1) {
+				pipes = 0;
+				for (line = next; line < size && data[line] != '\n'; line++)
+					if (data[line] == '|')
+						pipes++;
+
+				if (pipes == 0 || line == size)
+					break;
+			}
+		}
+
+		else if (prefix_quote(data + i, size - i))
+			state = SECTION_QUOTE;
+
+		else if (prefix_uli(data + i, size - i) || prefix_oli(data + i, size - i)) {
+			state = SECTION_LIST;
+			ordered = (prefix_uli(data + i, size - i) == 0);
+			orgpre = item_indent(data + i, size - i);
+			in_fence = 0;
+		}
+
+		/* an underline starting a paragraph makes an empty header */
+		else if ((level = is_headerline(data + i, size - i)) != 0)
+			underlined = 1;
+
+		else {
+			state = SECTION_PARAGRAPH;
+			last = i;
+		}
+
+		if (level) {
+			if (found && level <= found) {
+				*end = line;
+				return 1;
+			}
+
+			if (!found && count++ == index) {
+				found = level;
+				*beg = line;
+				*setext = underlined;
+			}
+		}
+
+		i = next;
+	}
+
+	*end = size;
+	return found;
+}
 
 
 /*********************
@@ -2401,6 +3686,7 @@ sd_markdown_new(
 	void *opaque)
 {
 	struct sd_markdown *md = NULL;
+	int i;
 
 	assert(max_nesting > 0 && callbacks);
 
@@ -2413,6 +3699,9 @@ sd_markdown_new(
 	stack_init(&md->work_bufs[BUFFER_BLOCK], 4);
 	stack_init(&md->work_bufs[BUFFER_SPAN], 8);
 
+	stack_init(&md->span_frames, 8);
+	stack_init(&md->block_frames, 8);
+
 	memset(md->active_char, 0x0, 256);
 
 	if (md->cb.emphasis || md->cb.double_emphasis || md->cb.triple_emphasis) {
@@ -2444,35 +3733,94 @@ sd_markdown_new(
 	if (extensions & MKDEXT_SUPERSCRIPT)
 		md->active_char['^'] = MD_CHAR_SUPERSCRIPT;
 
+	memset(md->block_char, 0x0, 256);
+
+	md->block_char['#'] = MD_BLOCK_ATX;
+	md->block_char['\n'] = MD_BLOCK_EMPTY;
+	md->block_char['*'] = MD_BLOCK_HRULE | MD_BLOCK_ULI;
+	md->block_char['-'] = MD_BLOCK_HRULE | MD_BLOCK_ULI;
+	md->block_char['_'] = MD_BLOCK_HRULE;
+	md->block_char['+'] = MD_BLOCK_ULI;
+	md->block_char['>'] = MD_BLOCK_QUOTE;
+
+	for (i = '0'; i <= '9'; ++i)
+		md->block_char[i] = MD_BLOCK_OLI;
+
+	if (md->cb.blockhtml)
+		md->block_char['<'] = MD_BLOCK_HTML;
+
+	if (extensions & MKDEXT_FENCED_CODE) {
+		md->block_char['~'] = MD_BLOCK_FENCE;
+		md->block_char['`'] = MD_BLOCK_FENCE;
+	}
+
 	/* Extension data */
 	md->ext_flags = extensions;
 	md->opaque = opaque;
 	md->max_nesting = max_nesting;
 	md->in_link_body = 0;
+	md->text_held.data = NULL;
+	md->text_held.size = 0;
+	md->events = (md->cb.enter != NULL && md->cb.leave != NULL);
+	md->spans = (md->cb.autolink || md->cb.codespan || md->cb.double_emphasis ||
+		md->cb.emphasis || md->cb.image || md->cb.linebreak || md->cb.link ||
+		md->cb.raw_html_tag || md->cb.triple_emphasis || md->cb.strikethrough ||
+		md->cb.superscript || md->cb.entity || md->cb.normal_text);
+	md->budget = md->budget_start = SIZE_MAX;
+	md->stopped = 0;
+	md->status = SD_RENDER_DONE;
+	md->step_limit = 0;
+	md->time_limit = 0;
+	md->render_id = 0;
+	md->cancel_id = 0;
+	memset(&md->autolink_stats, 0x0, sizeof(md->autolink_stats));
+	RNDR_STATS(memset(&md->stats, 0x0, sizeof(md->stats)));
 
 	return md;
 }
 
-void
-sd_markdown_render(struct buf *ob, const uint8_t *document, size_t doc_size, struct sd_markdown *md)
+/* render_document • renders a document, or only the section of its */
+/*	header given, within the budget set in md; returns 0 when there is */
+/*	no such section */
+static int
+render_document(struct buf *ob, const uint8_t *document, size_t doc_size,
+	size_t section, struct sd_markdown *md)
 {
 #define MARKDOWN_GROW(x) ((x) + ((x) >> 1))
 	static const char UTF8_BOM[] = {0xEF, 0xBB, 0xBF};
 
 	struct buf *text;
 	size_t beg, end;
+	int found = 1, setext = 0;
+	RNDR_STATS(size_t org = ob->size);
+	RNDR_STATS(double start = stats_clock());
 
 	text = bufnew(64);
 	if (!text)
-		return;
+		return 0;
 
 	/* Preallocate enough space for our buffer to avoid expanding while copying */
 	bufgrow(text, doc_size);
 
 	/* reset the references table */
 	memset(&md->refs, 0x0, REF_TABLE_SIZE * sizeof(void *));
+	htmlblock_reset(md);
+
+	/* reset the render limits, a cancel from now on being for this render */
+	RNDR_STORE(&md->render_id, md->render_id < LONG_MAX ? md->render_id + 1 : 1);
+	md->stopped = 0;
+	md->status = SD_RENDER_DONE;
+	md->steps = STEP_INTERVAL;
+	md->step_total = 0;
+	if (md->time_limit)
+		md->time_start = rndr_clock();
+
+	RNDR_STATS(memset(&md->stats, 0x0, sizeof(md->stats)));
+	RNDR_STATS(md->stats.input_size = doc_size);
 
 	/* first pass: looking for references, copying everything else */
+	/* references may come after the budget is spent, so all of the */
+	/* document goes through it */
 	beg = 0;
 
 	/* Skip a possible UTF-8 BOM, even though the Unicode standard
@@ -2502,23 +3850,47 @@ sd_markdown_render(struct buf *ob, const uint8_t *document, size_t doc_size, str
 			beg = end;
 		}
 
-	/* pre-grow the output buffer to minimize allocations */
-	bufgrow(ob, MARKDOWN_GROW(text->size));
+	RNDR_STATS(md->stats.preprocess_time = stats_clock() - start);
+
+	/* adding a final newline if not already present */
+	if (text->size && text->data[text->size - 1] != '\n' &&  text->data[text->size - 1] != '\r')
+		bufputc(text, '\n');
+
+	beg = 0;
+	end = text->size;
+
+	if (section != SIZE_MAX) {
+		found = find_section(md, text->data, text->size, section, &beg, &end, &setext);
+		htmlblock_reset(md);
+	}
 
-	/* second pass: actual rendering */
-	if (md->cb.doc_header)
-		md->cb.doc_header(ob, md->opaque);
+	if (found) {
+		/* pre-grow the output buffer to minimize allocations */
+		bufgrow(ob, MARKDOWN_GROW(end - beg));
+
+		/* second pass: actual rendering */
+		if (md->cb.doc_header)
+			md->cb.doc_header(ob, md->opaque);
+
+		/* a setext header is read as the end of its paragraph, as its */
+		/* lines on their own could start another block */
+		if (setext) {
+			push_block(md, BLOCK_SEQUENCE, ob, NULL, text->data + beg, end - beg);
+			beg += parse_paragraph(ob, md, text->data + beg, end - beg);
+			md->block_frames.size--;
+		}
 
-	if (text->size) {
-		/* adding a final newline if not already present */
-		if (text->data[text->size - 1] != '\n' &&  text->data[text->size - 1] != '\r')
-			bufputc(text, '\n');
+		if (end > beg)
+			parse_block(ob, md, text->data + beg, end - beg);
 
-		parse_block(ob, md, text->data, text->size);
+		if (md->cb.doc_footer)
+			md->cb.doc_footer(ob, md->opaque);
 	}
 
-	if (md->cb.doc_footer)
-		md->cb.doc_footer(ob, md->opaque);
+	if (md->stopped && md->status == SD_RENDER_DONE)
+		md->status = SD_RENDER_TRUNCATED;
+
+	RNDR_STATS(md->stats.output_size = ob->size - org);
 
 	/* clean-up */
 	bufrelease(text);
@@ -2526,6 +3898,50 @@ sd_markdown_render(struct buf *ob, const uint8_t *document, size_t doc_size, str
 
 	assert(md->work_bufs[BUFFER_SPAN].size == 0);
 	assert(md->work_bufs[BUFFER_BLOCK].size == 0);
+	return found;
+}
+
+void
+sd_markdown_render(struct buf *ob, const uint8_t *document, size_t doc_size, struct sd_markdown *md)
+{
+	md->budget = md->budget_start = SIZE_MAX;
+	render_document(ob, document, doc_size, SIZE_MAX, md);
+}
+
+int
+sd_markdown_render_section(struct buf *ob, const uint8_t *document, size_t doc_size,
+	size_t index, struct sd_markdown *md)
+{
+	md->budget = md->budget_start = SIZE_MAX;
+	return render_document(ob, document, doc_size, index, md);
+}
+
+int
+sd_markdown_preview(struct buf *ob, const uint8_t *document, size_t doc_size,
+	size_t budget, struct sd_markdown *md)
+{
+	md->budget = md->budget_start = budget;
+	render_document(ob, document, doc_size, SIZE_MAX, md);
+	return md->stopped;
+}
+
+void
+sd_markdown_set_limits(struct sd_markdown *md, size_t max_steps, unsigned long max_ms)
+{
+	md->step_limit = max_steps;
+	md->time_limit = max_ms;
+}
+
+void
+sd_markdown_cancel(struct sd_markdown *md)
+{
+	RNDR_STORE(&md->cancel_id, RNDR_LOAD(&md->render_id));
+}
+
+enum sd_render_status
+sd_markdown_status(const struct sd_markdown *md)
+{
+	return md->status;
 }
 
 void
@@ -2542,9 +3958,48 @@ sd_markdown_free(struct sd_markdown *md)
 	stack_free(&md->work_bufs[BUFFER_SPAN]);
 	stack_free(&md->work_bufs[BUFFER_BLOCK]);
 
+	for (i = 0; i < (size_t)md->span_frames.asize; ++i)
+		free(md->span_frames.item[i]);
+
+	for (i = 0; i < (size_t)md->block_frames.asize; ++i)
+		free(md->block_frames.item[i]);
+
+	stack_free(&md->span_frames);
+	stack_free(&md->block_frames);
+
 	free(md);
 }
 
+void
+sd_markdown_autolink_stats(struct sd_autolink_stats *stats, const struct sd_markdown *md)
+{
+	memcpy(stats, &md->autolink_stats, sizeof(struct sd_autolink_stats));
+}
+
+int
+sd_markdown_render_stats(struct sd_render_stats *stats, const struct sd_markdown *md)
+{
+#ifdef SD_RENDER_STATS
+	memcpy(stats, &md->stats, sizeof(struct sd_render_stats));
+	return 1;
+#else
+	memset(stats, 0x0, sizeof(struct sd_render_stats));
+	return 0;
+#endif
+}
+
+const char *
+sd_html_entity(const uint8_t *name, size_t size)
+{
+	const struct html_entity *entity;
+
+	if (size > ENTITY_MAX_LENGTH)
+		return NULL;
+
+	entity = find_entity((const char *)name, (unsigned int)size);
+	return entity ? entity->utf8 : NULL;
+}
+
 void
 sd_version(int *ver_major, int *ver_minor, int *ver_revision)
 {
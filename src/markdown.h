@@ -59,6 +59,47 @@ enum mkd_extensions {
 	MKDEXT_SPACE_HEADERS = (1 << 6),
 	MKDEXT_SUPERSCRIPT = (1 << 7),
 	MKDEXT_LAX_SPACING = (1 << 8),
+	MKDEXT_STRICT_ENTITIES = (1 << 9),
+};
+
+/* sd_node_type - elements reported by the enter and leave callbacks */
+enum sd_node_type {
+	SD_NODE_BLOCKQUOTE,
+	SD_NODE_HEADER,
+	SD_NODE_LIST,
+	SD_NODE_LISTITEM,
+	SD_NODE_PARAGRAPH,
+	SD_NODE_TABLE,
+	SD_NODE_TABLE_HEAD,
+	SD_NODE_TABLE_BODY,
+	SD_NODE_TABLE_ROW,
+	SD_NODE_TABLE_CELL,
+
+	SD_NODE_EMPHASIS,
+	SD_NODE_DOUBLE_EMPHASIS,
+	SD_NODE_TRIPLE_EMPHASIS,
+	SD_NODE_STRIKETHROUGH,
+	SD_NODE_SUPERSCRIPT,
+	SD_NODE_LINK,
+};
+
+/* sd_node - an element whose content is rendered between enter and leave */
+struct sd_node {
+	enum sd_node_type type;
+	int flags;					/* header level, list or table cell flags */
+	const struct buf *link;		/* unescaped link target, or NULL */
+	const struct buf *title;	/* link title, or NULL */
+	size_t parent_offset;		/* where the content of the parent starts in ob */
+	size_t offset;				/* size of ob before enter */
+	size_t content_offset;		/* size of ob after enter, for leave */
+
+	/* spans only: their markdown, and where the content parsed between */
+	/* enter and leave lies in it; the content is empty and at the end */
+	/* when nesting limits leave it unparsed */
+	const uint8_t *source;
+	size_t source_size;
+	size_t content_begin;
+	size_t content_end;
 };
 
 /* sd_callbacks - functions for rendering parsed data */
@@ -97,6 +138,91 @@ struct sd_callbacks {
 	/* header and footer */
 	void (*doc_header)(struct buf *ob, void *opaque);
 	void (*doc_footer)(struct buf *ob, void *opaque);
+
+	/* table streaming - when table_begin is set, body rows are rendered */
+	/* straight into the output between table_begin and table_end, */
+	/* and the table callback is not used */
+	void (*table_begin)(struct buf *ob, const struct buf *header, void *opaque);
+	void (*table_end)(struct buf *ob, void *opaque);
+
+	/* single-pass rendering - when enter and leave are set, the content */
+	/* of the elements in sd_node_type is rendered straight into the */
+	/* output between the two instead of being handed over in a buffer; */
+	/* their callback above must still be set, NULL skips them as before, */
+	/* but it is no longer called. */
+	/* For spans, returning 0 drops the output and prints them verbatim */
+	int (*enter)(struct buf *ob, const struct sd_node *node, void *opaque);
+	int (*leave)(struct buf *ob, const struct sd_node *node, void *opaque);
+};
+
+/* sd_render_status - how the last render of a parser ended */
+enum sd_render_status {
+	SD_RENDER_DONE,			/* all of the document was rendered */
+	SD_RENDER_TRUNCATED,	/* sd_markdown_preview spent its budget */
+	SD_RENDER_TIMEOUT,		/* the limits of sd_markdown_set_limits were reached */
+	SD_RENDER_CANCELLED,	/* sd_markdown_cancel was called */
+};
+
+/* sd_autolink_stats - autolink trigger counts, kept for the parser's lifetime */
+struct sd_autolink_stats {
+	size_t triggers;	/* 'w', ':' and '@' reached while autolinking */
+	size_t filtered;	/* turned down before any buffer was taken */
+	size_t links;		/* rendered as links */
+};
+
+/* sd_stats_block - block parsers counted in sd_render_stats */
+enum sd_stats_block {
+	SD_STATS_HEADER,		/* atx headers, setext ones being paragraphs */
+	SD_STATS_HTML,
+	SD_STATS_HRULE,
+	SD_STATS_FENCEDCODE,
+	SD_STATS_TABLE,
+	SD_STATS_BLOCKQUOTE,
+	SD_STATS_CODE,
+	SD_STATS_LIST,
+	SD_STATS_LISTITEM,
+	SD_STATS_PARAGRAPH,
+	SD_STATS_BLOCK_COUNT
+};
+
+/* sd_stats_trigger - inline parsers counted in sd_render_stats */
+enum sd_stats_trigger {
+	SD_STATS_EMPHASIS,
+	SD_STATS_CODESPAN,
+	SD_STATS_LINEBREAK,
+	SD_STATS_LINK,
+	SD_STATS_LANGLE,
+	SD_STATS_ESCAPE,
+	SD_STATS_ENTITY,
+	SD_STATS_AUTOLINK_URL,
+	SD_STATS_AUTOLINK_EMAIL,
+	SD_STATS_AUTOLINK_WWW,
+	SD_STATS_SUPERSCRIPT,
+	SD_STATS_TRIGGER_COUNT
+};
+
+/* sd_render_stats - what the last render went through, collected only */
+/* when the library is built with SD_RENDER_STATS defined */
+struct sd_render_stats {
+	size_t input_size;			/* bytes of the document */
+	size_t output_size;			/* bytes added to the output */
+	double preprocess_time;		/* milliseconds of the reference pass */
+
+	size_t blocks[SD_STATS_BLOCK_COUNT];
+	size_t triggers[SD_STATS_TRIGGER_COUNT];
+
+	/* inline parsers run for each active char: hits took it, misses */
+	/* returned 0 and left it as text */
+	size_t trigger_hits[256];
+	size_t trigger_misses[256];
+
+	/* work buffers, block then span: most in use at once, and how */
+	/* many were allocated rather than taken from the pool */
+	size_t work_bufs_max[2];
+	size_t work_bufs_new[2];
+
+	/* deepest nesting of work buffers, the count limited by max_nesting */
+	size_t max_nesting;
 };
 
 struct sd_markdown;
@@ -123,9 +249,62 @@ sd_markdown_new(
 extern void
 sd_markdown_render(struct buf *ob, const uint8_t *document, size_t doc_size, struct sd_markdown *md);
 
+/* sd_markdown_render_section - sd_markdown_render for the section of the */
+/* index-th header at the top level of the document, counting from 0: */
+/* the header and the blocks after it up to the next header of its level */
+/* or above, with the references of the whole document. Headers are found */
+/* by a scan of the block starts that parses no inline markdown; HTML_TOC */
+/* gives header index the id toc_<index> when no header lies in a list or */
+/* a blockquote. Returns 0, rendering nothing, when there is no such header */
+extern int
+sd_markdown_render_section(struct buf *ob, const uint8_t *document, size_t doc_size,
+	size_t index, struct sd_markdown *md);
+
+/* sd_markdown_preview - sd_markdown_render for about the first budget */
+/* chars of visible text, parsing no further: the text past them is left */
+/* out, cut after a whole word, with every element open at that point */
+/* closed as usual; returns 1 when something was left out */
+extern int
+sd_markdown_preview(struct buf *ob, const uint8_t *document, size_t doc_size,
+	size_t budget, struct sd_markdown *md);
+
 extern void
 sd_markdown_free(struct sd_markdown *md);
 
+/* sd_markdown_set_limits - bounds the later renders to about max_steps */
+/* blocks and inline triggers and to max_ms milliseconds, 0 leaving either */
+/* unbounded; a render going past them stops early, with the elements */
+/* open at that point closed, and ends with SD_RENDER_TIMEOUT */
+extern void
+sd_markdown_set_limits(struct sd_markdown *md, size_t max_steps, unsigned long max_ms);
+
+/* sd_markdown_cancel - stops the render under way, as sd_markdown_set_limits */
+/* would, ending it with SD_RENDER_CANCELLED; unlike the other calls, it may */
+/* come from another thread. With no render under way, as when it comes */
+/* late, it has no effect: the later renders are not cancelled */
+extern void
+sd_markdown_cancel(struct sd_markdown *md);
+
+/* sd_markdown_status - how the last render ended, for callers to fall back */
+/* on something else, such as escaped text, when it did not end with */
+/* SD_RENDER_DONE */
+extern enum sd_render_status
+sd_markdown_status(const struct sd_markdown *md);
+
+extern void
+sd_markdown_autolink_stats(struct sd_autolink_stats *stats, const struct sd_markdown *md);
+
+/* sd_markdown_render_stats - copies the sd_render_stats of the last */
+/* render, returning 0 with them all zero when the library was built */
+/* without SD_RENDER_STATS */
+extern int
+sd_markdown_render_stats(struct sd_render_stats *stats, const struct sd_markdown *md);
+
+/* sd_html_entity - UTF-8 value of an HTML5 named entity, given without */
+/* its '&' and ';', or NULL when the name is unknown */
+extern const char *
+sd_html_entity(const uint8_t *name, size_t size);
+
 extern void
 sd_version(int *major, int *minor, int *revision);
 
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2011, Vicent Marti
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "markdown.h"
+#include "text.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+#include "houdini.h"
+#include "html.h"
+
+/* text_newline • ends the line of the previous block, if any */
+static inline void
+text_newline(struct buf *ob)
+{
+	if (ob->size && ob->data[ob->size - 1] != '\n')
+		bufputc(ob, '\n');
+}
+
+/* text_block • a block handed over whole, as when nesting runs too deep */
+static void
+text_block(struct buf *ob, const struct buf *text)
+{
+	text_newline(ob);
+	if (text)
+		bufput(ob, text->data, text->size);
+	text_newline(ob);
+}
+
+static void
+rndr_blockcode(struct buf *ob, const struct buf *text, const struct buf *lang, void *opaque)
+{
+	text_block(ob, text);
+}
+
+static void
+rndr_block(struct buf *ob, const struct buf *text, void *opaque)
+{
+	text_block(ob, text);
+}
+
+/* rndr_blockhtml • the text between the tags on one line, the code of */
+/*	scripts and styles and the comments left out */
+static void
+rndr_blockhtml(struct buf *ob, const struct buf *text, void *opaque)
+{
+	const uint8_t *data = text->data;
+	const char *skip = NULL;
+	size_t i = 0, org, size = text->size, start, j;
+
+	text_newline(ob);
+	start = ob->size;
+
+	while (i < size) {
+		org = i;
+		while (i < size && data[i] != '<')
+			i++;
+
+		if (i > org && !skip)
+			houdini_unescape_html(ob, data + org, i - org);
+
+		if (i >= size)
+			break;
+
+		if (i + 3 < size && memcmp(data + i, "<!--", 4) == 0) {
+			for (i += 4; i + 2 < size && memcmp(data + i, "-->", 3) != 0; i++);
+			i += 3;
+			continue;
+		}
+
+		org = i;
+		while (i < size && data[i] != '>')
+			i++;
+
+		if (i < size)
+			i++;
+
+		if (skip) {
+			if (sdhtml_is_tag(data + org, i - org, skip) == HTML_TAG_CLOSE)
+				skip = NULL;
+		} else if (sdhtml_is_tag(data + org, i - org, "script") == HTML_TAG_OPEN)
+			skip = "script";
+		else if (sdhtml_is_tag(data + org, i - org, "style") == HTML_TAG_OPEN)
+			skip = "style";
+	}
+
+	/* the layout of the source is not kept: runs of spaces become one */
+	for (i = j = start; i < ob->size; ++i) {
+		if (isspace(ob->data[i])) {
+			if (j > start && ob->data[j - 1] != ' ')
+				ob->data[j++] = ' ';
+		} else
+			ob->data[j++] = ob->data[i];
+	}
+
+	if (j > start && ob->data[j - 1] == ' ')
+		j--;
+
+	ob->size = j;
+	text_newline(ob);
+}
+
+static void
+rndr_header(struct buf *ob, const struct buf *text, int level, void *opaque)
+{
+	text_block(ob, text);
+}
+
+static void
+rndr_hrule(struct buf *ob, void *opaque)
+{
+	text_newline(ob);
+}
+
+static void
+rndr_list(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+	text_block(ob, text);
+}
+
+static void
+rndr_table(struct buf *ob, const struct buf *header, const struct buf *body, void *opaque)
+{
+	text_block(ob, header);
+	if (body)
+		bufput(ob, body->data, body->size);
+}
+
+static void
+rndr_tablecell(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+	if (ob->size && ob->data[ob->size - 1] != '\n')
+		bufputc(ob, '\t');
+
+	if (text)
+		bufput(ob, text->data, text->size);
+}
+
+static int
+rndr_autolink(struct buf *ob, const struct buf *link, enum mkd_autolink type, void *opaque)
+{
+	if (!link || !link->size)
+		return 0;
+
+	if (bufprefix(link, "mailto:") == 0)
+		bufput(ob, link->data + 7, link->size - 7);
+	else
+		bufput(ob, link->data, link->size);
+
+	return 1;
+}
+
+/* rndr_span • emphasis and the other spans reduced to their content */
+static int
+rndr_span(struct buf *ob, const struct buf *text, void *opaque)
+{
+	if (!text || !text->size)
+		return 0;
+
+	bufput(ob, text->data, text->size);
+	return 1;
+}
+
+static int
+rndr_codespan(struct buf *ob, const struct buf *text, void *opaque)
+{
+	if (text)
+		bufput(ob, text->data, text->size);
+	return 1;
+}
+
+static int
+rndr_image(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *alt, void *opaque)
+{
+	if (!link || !link->size)
+		return 0;
+
+	if (alt)
+		bufput(ob, alt->data, alt->size);
+	return 1;
+}
+
+static int
+rndr_image_skip(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *alt, void *opaque)
+{
+	return (link && link->size);
+}
+
+static int
+rndr_linebreak(struct buf *ob, void *opaque)
+{
+	bufputc(ob, '\n');
+	return 1;
+}
+
+static int
+rndr_link(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *content, void *opaque)
+{
+	if (content)
+		bufput(ob, content->data, content->size);
+	return 1;
+}
+
+static int
+rndr_raw_html(struct buf *ob, const struct buf *text, void *opaque)
+{
+	return 1;
+}
+
+static void
+rndr_entity(struct buf *ob, const struct buf *entity, void *opaque)
+{
+	houdini_unescape_html(ob, entity->data, entity->size);
+}
+
+static int
+rndr_enter(struct buf *ob, const struct sd_node *node, void *opaque)
+{
+	switch (node->type) {
+	case SD_NODE_BLOCKQUOTE:
+	case SD_NODE_HEADER:
+	case SD_NODE_LIST:
+	case SD_NODE_LISTITEM:
+	case SD_NODE_PARAGRAPH:
+	case SD_NODE_TABLE:
+	case SD_NODE_TABLE_ROW:
+		text_newline(ob);
+		break;
+
+	case SD_NODE_TABLE_CELL:
+		/* the first cell starts where its row does */
+		if (ob->size > node->parent_offset)
+			bufputc(ob, '\t');
+		break;
+
+	default:
+		break;
+	}
+
+	return 1;
+}
+
+static int
+rndr_leave(struct buf *ob, const struct sd_node *node, void *opaque)
+{
+	switch (node->type) {
+	case SD_NODE_HEADER:
+	case SD_NODE_LISTITEM:
+	case SD_NODE_PARAGRAPH:
+	case SD_NODE_TABLE_ROW:
+		text_newline(ob);
+		break;
+
+	case SD_NODE_EMPHASIS:
+	case SD_NODE_DOUBLE_EMPHASIS:
+	case SD_NODE_TRIPLE_EMPHASIS:
+	case SD_NODE_STRIKETHROUGH:
+	case SD_NODE_SUPERSCRIPT:
+		/* empty spans are printed verbatim, as the HTML renderer does */
+		return (ob->size > node->content_offset);
+
+	default:
+		break;
+	}
+
+	return 1;
+}
+
+void
+sdtext_renderer(struct sd_callbacks *callbacks, unsigned int render_flags)
+{
+	static const struct sd_callbacks cb_default = {
+		rndr_blockcode,
+		rndr_block,
+		rndr_blockhtml,
+		rndr_header,
+		rndr_hrule,
+		rndr_list,
+		rndr_list,
+		rndr_block,
+		rndr_table,
+		rndr_block,
+		rndr_tablecell,
+
+		rndr_autolink,
+		rndr_codespan,
+		rndr_span,
+		rndr_span,
+		rndr_image,
+		rndr_linebreak,
+		rndr_link,
+		rndr_raw_html,
+		rndr_span,
+		rndr_span,
+		rndr_span,
+
+		rndr_entity,
+		NULL,
+
+		NULL,
+		NULL,
+
+		NULL,
+		NULL,
+
+		rndr_enter,
+		rndr_leave,
+	};
+
+	memcpy(callbacks, &cb_default, sizeof(struct sd_callbacks));
+
+	if (render_flags & TEXT_SKIP_CODE)
+		callbacks->blockcode = NULL;
+
+	if (render_flags & TEXT_SKIP_IMAGES)
+		callbacks->image = rndr_image_skip;
+}
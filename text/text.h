@@ -0,0 +1,46 @@
+/* text.h - plain text renderer, for search indexing and the like */
+
+/*
+ * Copyright (c) 2011, Vicent Marti
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef UPSKIRT_TEXT_H
+#define UPSKIRT_TEXT_H
+
+#include "markdown.h"
+#include "buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+	TEXT_SKIP_CODE = (1 << 0),		/* leaves code blocks out */
+	TEXT_SKIP_IMAGES = (1 << 1),	/* leaves the alt text of images out */
+} text_render_mode;
+
+/* sdtext_renderer - callbacks printing the text a reader would see, */
+/* unescaped, with one line per block and tabs between table cells; */
+/* they take no opaque pointer */
+extern void
+sdtext_renderer(struct sd_callbacks *callbacks, unsigned int render_flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/* vim: set filetype=c: */